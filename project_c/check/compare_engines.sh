@@ -0,0 +1,32 @@
+#!/bin/bash
+# Solves instances with the LEMON matching engine and with the automatic engine choice (subset DP or dense blossom
+# kernel), checks that both report the same optimum, and prints the pricing times and the speedup of the automatic
+# choice. Usage: check/compare_engines.sh [<instance>...], run from the project directory.
+
+BIN=bin/srrsolver
+INSTANCES=${@:-instances/bin006_050_000.srr instances/bin006_050_001.srr instances/bin012_080_000.srr}
+
+# prints the primal bound and the execution time of the matching pricer from the statistics
+solve()
+{
+    $BIN -f $1 -s $2 | awk '/^Primal Bound/ && bound == "" { bound = $4 }
+        /^Pricers/ { pricers = 1; next }
+        pricers && /^  matchingpricer/ { time = $3; pricers = 0 }
+        END { print bound, time }'
+}
+
+FAILED=0
+for INST in $INSTANCES
+do
+    read LEMONBOUND LEMONTIME <<< $(solve $INST settings/engine_lemon.set)
+    read AUTOBOUND AUTOTIME <<< $(solve $INST settings/engine_auto.set)
+    if [ -z "$LEMONBOUND" ] || [ "$LEMONBOUND" != "$AUTOBOUND" ]
+    then
+        echo "FAIL ${INST}: lemon ${LEMONBOUND}, auto ${AUTOBOUND}"
+        FAILED=1
+    else
+        SPEEDUP=$(awk -v l=$LEMONTIME -v a=$AUTOTIME 'BEGIN { if( a > 0 ) printf "%.2f", l / a; else print "-" }')
+        echo "ok   ${INST}: ${LEMONBOUND}, pricing time lemon ${LEMONTIME}s, auto ${AUTOTIME}s, speedup ${SPEEDUP}"
+    fi
+done
+exit $FAILED
@@ -0,0 +1,23 @@
+#!/bin/bash
+# Solves instances with Farkas pricing and with big-M artificial columns as phase one, and checks that both modes
+# report the same optimum. Usage: check/compare_phaseone.sh [<instance>...], run from the project directory.
+
+BIN=bin/srrsolver
+INSTANCES=${@:-instances/bin006_050_000.srr instances/bin006_050_001.srr instances/bin012_080_000.srr}
+
+FAILED=0
+for INST in $INSTANCES
+do
+    FARKAS=$($BIN -f $INST -s settings/phaseone_farkas.set | grep -m1 "^Primal Bound" | awk '{print $4}')
+    BIGM=$($BIN -f $INST -s settings/phaseone_bigm.set | grep -m1 "^Primal Bound" | awk '{print $4}')
+
+    if [ -z "$FARKAS" ] || [ "$FARKAS" != "$BIGM" ]
+    then
+        echo "FAIL ${INST}: farkas ${FARKAS}, big-M ${BIGM}"
+        FAILED=1
+    else
+        echo "ok   ${INST}: ${FARKAS}"
+    fi
+done
+
+exit $FAILED
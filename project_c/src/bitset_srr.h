@@ -0,0 +1,94 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   bitset_srr.h
+ * @brief  bitsets over the edges (matches) of the complete graph on the teams
+ * @author Jasper van Doornmalen
+ *
+ * Bit k of an edge bitset corresponds to match k in the ordering of SCIPmatchGetIndex().
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SRR_BITSET_H__
+#define __SRR_BITSET_H__
+
+#include <stdint.h>
+
+#include "scip/def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint64_t SRR_BITWORD;                /**< word of an edge bitset */
+
+#define SRR_BITWORDSIZE 64                   /**< number of bits in a word of an edge bitset */
+
+/** number of words needed for a bitset of nbits bits */
+#define SRRbitsetNWords(nbits) (((nbits) + SRR_BITWORDSIZE - 1) / SRR_BITWORDSIZE)
+
+/** returns whether bit idx is set */
+static INLINE
+SCIP_Bool SRRbitsetIsSet(
+   const SRR_BITWORD*    bitset,             /**< bitset */
+   int                   idx                 /**< index of bit */
+   )
+{
+   return (bitset[idx / SRR_BITWORDSIZE] >> (idx % SRR_BITWORDSIZE)) & 1 ? TRUE : FALSE;
+}
+
+/** sets bit idx */
+static INLINE
+void SRRbitsetSet(
+   SRR_BITWORD*          bitset,             /**< bitset */
+   int                   idx                 /**< index of bit */
+   )
+{
+   bitset[idx / SRR_BITWORDSIZE] |= ((SRR_BITWORD) 1) << (idx % SRR_BITWORDSIZE);
+}
+
+/** clears bit idx */
+static INLINE
+void SRRbitsetUnset(
+   SRR_BITWORD*          bitset,             /**< bitset */
+   int                   idx                 /**< index of bit */
+   )
+{
+   bitset[idx / SRR_BITWORDSIZE] &= ~(((SRR_BITWORD) 1) << (idx % SRR_BITWORDSIZE));
+}
+
+/** sets the first nbits bits, and clears the remaining bits of the last word */
+static INLINE
+void SRRbitsetSetAll(
+   SRR_BITWORD*          bitset,             /**< bitset */
+   int                   nbits               /**< number of bits of bitset */
+   )
+{
+   int w;
+   int nwords;
+
+   nwords = SRRbitsetNWords(nbits);
+   for (w = 0; w < nwords; ++w)
+      bitset[w] = ~((SRR_BITWORD) 0);
+   if ( nbits % SRR_BITWORDSIZE != 0 )
+      bitset[nwords - 1] = (((SRR_BITWORD) 1) << (nbits % SRR_BITWORDSIZE)) - 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
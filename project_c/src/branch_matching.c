@@ -24,6 +24,7 @@
 
 #include "branch_matching.h"
 #include "probdata_srr.h"
+#include "vardata_srr.h"
 #include "cons_matchonround.h"
 
 
@@ -175,9 +176,11 @@ SCIP_DECL_BRANCHEXECLP(branchExecsrr)
 
          for (c = 0; c < ncols; ++c)
          {
-            /* we stored the round of the variable in its vardata */
+            /* the variable data holds the round of the variable; artificial columns have none */
             var = SCIPcolGetVar(cols[c]);
-            r = (int) (long) SCIPvarGetData(var);
+            if ( SCIPvarGetData(var) == NULL )
+               continue;
+            r = SCIPvardataGetRoundSRR(SCIPvarGetData(var));
             varval = SCIPgetSolVal(scip, NULL, var);
             matchroundsol[k * nrounds + r] += varval;
             modelisintegral = modelisintegral && !SCIPisGT(scip, MIN(varval, 1.0 - varval), 0.0);
@@ -23,6 +23,7 @@
 #include "scip/scip.h"
 #include "cons_matchonround.h"
 #include "probdata_srr.h"
+#include "vardata_srr.h"
 
 
 /* fundamental constraint handler properties */
@@ -61,11 +62,104 @@ struct SCIP_ConsData
 };
 
 /** constraint handler data */
+struct SCIP_ConshdlrData
+{
+   int                   nteams;             /**< number of teams */
+   int                   nrounds;            /**< number of rounds */
+   int                   nedges;             /**< number of edges (matches) */
+   int                   nwords;             /**< number of words of an edge bitset */
+   int*                  nforbidding;        /**< number of active constraints forbidding edge k on round r (at r * nedges + k) */
+   int*                  nforcing;           /**< number of active constraints forcing edge k on round r (at r * nedges + k) */
+   SRR_BITWORD*          allowededges;       /**< bitsets of edges with nforbidding zero (round r at r * nwords) */
+   SRR_BITWORD*          forcededges;        /**< bitsets of edges with nforcing nonzero (round r at r * nwords) */
+   SCIP_Bool*            roundchanged;       /**< did round r lose an allowed edge since the last propagation? */
+   SCIP_Bool             anychanged;         /**< did any round lose an allowed edge since the last propagation? */
+};
 
 /*
  * Local methods
  */
 
+/** adds delta to the number of active constraints forbidding edge k on round r, and updates the allowed bitset */
+static
+void updateForbidding(
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   int                   k,                  /**< edge */
+   int                   r,                  /**< round */
+   int                   delta               /**< +1 on activation, -1 on deactivation */
+)
+{
+   int* nforbidding;
+
+   nforbidding = &conshdlrdata->nforbidding[r * conshdlrdata->nedges + k];
+   *nforbidding += delta;
+   assert( *nforbidding >= 0 );
+
+   if ( *nforbidding == 0 )
+      SRRbitsetSet(&conshdlrdata->allowededges[r * conshdlrdata->nwords], k);
+   else
+      SRRbitsetUnset(&conshdlrdata->allowededges[r * conshdlrdata->nwords], k);
+
+   /* only a newly forbidden edge can make columns of the round invalid */
+   if ( delta > 0 && *nforbidding == 1 )
+   {
+      conshdlrdata->roundchanged[r] = TRUE;
+      conshdlrdata->anychanged = TRUE;
+   }
+}
+
+/** updates the edge bitsets for the (de)activation of a constraint */
+static
+void updateRoundEdges(
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   SCIP_CONSDATA*        consdata,           /**< data of the (de)activated constraint */
+   int                   delta               /**< +1 on activation, -1 on deactivation */
+)
+{
+   int* nforcing;
+   int nteams;
+   int k;
+   int r;
+   int t;
+
+   nteams = conshdlrdata->nteams;
+   k = SCIPmatchGetIndex(nteams, consdata->i, consdata->j);
+
+   if ( !consdata->permitted )
+   {
+      /* i and j must not play against one other on round r. */
+      updateForbidding(conshdlrdata, k, consdata->r, delta);
+      return;
+   }
+
+   /* i and j must play on r, not on any other round. */
+   for (r = 0; r < conshdlrdata->nrounds; ++r)
+   {
+      if ( r != consdata->r )
+         updateForbidding(conshdlrdata, k, r, delta);
+   }
+
+   /* on round r, neither i nor j play against another opponent. */
+   for (t = 0; t < nteams; ++t)
+   {
+      if ( t == consdata->i || t == consdata->j )
+         continue;
+      updateForbidding(conshdlrdata, SCIPmatchGetIndex(nteams, MIN(t, consdata->i), MAX(t, consdata->i)),
+         consdata->r, delta);
+      updateForbidding(conshdlrdata, SCIPmatchGetIndex(nteams, MIN(t, consdata->j), MAX(t, consdata->j)),
+         consdata->r, delta);
+   }
+
+   nforcing = &conshdlrdata->nforcing[consdata->r * conshdlrdata->nedges + k];
+   *nforcing += delta;
+   assert( *nforcing >= 0 );
+
+   if ( *nforcing > 0 )
+      SRRbitsetSet(&conshdlrdata->forcededges[consdata->r * conshdlrdata->nwords], k);
+   else
+      SRRbitsetUnset(&conshdlrdata->forcededges[consdata->r * conshdlrdata->nwords], k);
+}
+
 SCIP_RETCODE SCIPgetConstraintDataSRRmor(
    SCIP_CONS* cons,
    int* i,
@@ -97,6 +191,71 @@ SCIP_RETCODE SCIPgetConstraintDataSRRmor(
 static
 SCIP_DECL_CONSFREE(consFreeSRR)
 {  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   SCIPfreeBlockMemory(scip, &conshdlrdata);
+   SCIPconshdlrSetData(conshdlr, NULL);
+
+   return SCIP_OKAY;
+}
+
+
+/** solving process initialization method of constraint handler (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_CONSINITSOL(consInitsolSRR)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_Real* coefs;
+   SCIP_CONS** conssmatchingonround;
+   SCIP_CONS** conssmatchisplayed;
+   int r;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   SCIP_CALL( SCIPgetProblemDataSRR(scip, &conshdlrdata->nteams, &conshdlrdata->nrounds, &coefs,
+      &conssmatchingonround, &conssmatchisplayed) );
+
+   conshdlrdata->nedges = (conshdlrdata->nteams / 2) * (conshdlrdata->nteams - 1);
+   conshdlrdata->nwords = SRRbitsetNWords(conshdlrdata->nedges);
+
+   /* no branching decisions, yet: every edge is allowed, none is forced */
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &conshdlrdata->nforbidding,
+      conshdlrdata->nrounds * conshdlrdata->nedges) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &conshdlrdata->nforcing,
+      conshdlrdata->nrounds * conshdlrdata->nedges) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &conshdlrdata->allowededges,
+      conshdlrdata->nrounds * conshdlrdata->nwords) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &conshdlrdata->forcededges,
+      conshdlrdata->nrounds * conshdlrdata->nwords) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &conshdlrdata->roundchanged, conshdlrdata->nrounds) );
+   conshdlrdata->anychanged = FALSE;
+
+   for (r = 0; r < conshdlrdata->nrounds; ++r)
+      SRRbitsetSetAll(&conshdlrdata->allowededges[r * conshdlrdata->nwords], conshdlrdata->nedges);
+
+   return SCIP_OKAY;
+}
+
+
+/** solving process deinitialization method of constraint handler (called before branch and bound process data is freed) */
+static
+SCIP_DECL_CONSEXITSOL(consExitsolSRR)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->roundchanged, conshdlrdata->nrounds);
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->forcededges, conshdlrdata->nrounds * conshdlrdata->nwords);
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->allowededges, conshdlrdata->nrounds * conshdlrdata->nwords);
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->nforcing, conshdlrdata->nrounds * conshdlrdata->nedges);
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->nforbidding, conshdlrdata->nrounds * conshdlrdata->nedges);
+
    return SCIP_OKAY;
 }
 
@@ -122,10 +281,72 @@ SCIP_DECL_CONSDELETE(consDeleteSRR)
 }
 
 
+/** constraint activation notification method of constraint handler */
+static
+SCIP_DECL_CONSACTIVE(consActiveSRR)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   assert( conshdlrdata->nforbidding != NULL );
+
+   updateRoundEdges(conshdlrdata, SCIPconsGetData(cons), +1);
+
+   return SCIP_OKAY;
+}
+
+
+/** constraint deactivation notification method of constraint handler */
+static
+SCIP_DECL_CONSDEACTIVE(consDeactiveSRR)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   assert( conshdlrdata->nforbidding != NULL );
+
+   updateRoundEdges(conshdlrdata, SCIPconsGetData(cons), -1);
+
+   return SCIP_OKAY;
+}
+
+
+/** checks whether an artificial column of big-M phase one is positive in a solution
+ *
+ * The artificial columns are the variables without variable data. They fill the round- and match-constraints without
+ * playing any match, so a solution using them is no schedule.
+ */
+static
+SCIP_Bool solUsesArtificials(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SOL*             sol                 /**< solution, or NULL for the current solution */
+)
+{
+   SCIP_VAR** vars;
+   int nvars;
+   int v;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   for (v = 0; v < nvars; ++v)
+   {
+      if ( SCIPvarGetData(vars[v]) == NULL && SCIPisFeasPositive(scip, SCIPgetSolVal(scip, sol, vars[v])) )
+         return TRUE;
+   }
+
+   return FALSE;
+}
+
+
 /** constraint enforcing method of constraint handler for LP solutions */
 static
 SCIP_DECL_CONSENFOLP(consEnfolpSRR)
 {  /*lint --e{715}*/
+   *result = solUsesArtificials(scip, NULL) ? SCIP_INFEASIBLE : SCIP_FEASIBLE;
+
    return SCIP_OKAY;
 }
 
@@ -134,6 +355,8 @@ SCIP_DECL_CONSENFOLP(consEnfolpSRR)
 static
 SCIP_DECL_CONSENFOPS(consEnfopsSRR)
 {  /*lint --e{715}*/
+   *result = solUsesArtificials(scip, NULL) ? SCIP_INFEASIBLE : SCIP_FEASIBLE;
+
    return SCIP_OKAY;
 }
 
@@ -142,6 +365,15 @@ SCIP_DECL_CONSENFOPS(consEnfopsSRR)
 static
 SCIP_DECL_CONSCHECK(consCheckSRR)
 {  /*lint --e{715}*/
+   *result = SCIP_FEASIBLE;
+
+   if ( solUsesArtificials(scip, sol) )
+   {
+      *result = SCIP_INFEASIBLE;
+      if ( printreason )
+         SCIPinfoMessage(scip, NULL, "solution uses an artificial column\n");
+   }
+
    return SCIP_OKAY;
 }
 
@@ -152,142 +384,63 @@ SCIP_DECL_CONSLOCK(consLockSRR)
    return SCIP_OKAY;
 }
 
-/** domain propagation method of constraint handler */
+/** domain propagation method of constraint handler
+ *
+ * The edges that the active constraints leave on each round are kept in the constraint handler data, see
+ * updateRoundEdges(), so the constraints in conss are not looked at. A matching variable is fixed to zero if its
+ * matching uses an edge that is not left on its round. Only the rounds that lost an edge since the last propagation are
+ * checked: columns priced since then only use allowed edges, and the fixings of earlier propagations stay valid in the
+ * subtree. Switching to another part of the tree activates the constraints of the new path, which marks their rounds.
+ */
 static
 SCIP_DECL_CONSPROP(consPropSRR)
 {
-   int nteams;
-   int nrounds;
-   SCIP_Real* coefs;
-   SCIP_CONS** conssmatchingonround;
-   SCIP_CONS** conssmatchisplayed;
-
-   int cid;
-   SCIP_CONS* cons;
-   SCIP_CONSDATA* consdata;
-   int c;
-   int i;
-   int j;
-   int k;
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_VARDATA* vardata;
+   SCIP_VAR** vars;
+   int nvars;
+   int v;
    int r;
-   SCIP_ROW* row;
-   SCIP_COL** cols;
-   int ncols;
-   SCIP_VAR* var;
-
-   SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &nrounds, &coefs, &conssmatchingonround,
-      &conssmatchisplayed) );
 
    assert( scip != NULL );
    assert( conss != NULL || nconss <= 0 );
    assert( nconss >= 0 );
 
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   assert( conshdlrdata->allowededges != NULL );
+
    *result = SCIP_DIDNOTFIND;
 
-   for(cid = 0; cid < nconss; ++cid)
-   {
-      /* @todo! */
-      cons = conss[cid];
-      assert( cons != NULL );
+   if ( !conshdlrdata->anychanged )
+      return SCIP_OKAY;
 
-      consdata = SCIPconsGetData(cons);
-      assert( consdata != NULL );
-      assert( consdata->i < consdata->j );
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
 
-      if ( consdata->permitted )
-      {
-         /* team i must play against team j in round r. */
-         k = -1;
-         for (i = 0; i < nteams; ++i)
-         {
-            for (j = i + 1; j < nteams; ++j)
-            {
-               ++k;
-
-               SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchisplayed[k], &cons) );
-               row = SCIPconsGetRow(scip, cons);
-               cols = SCIProwGetCols(row);
-               ncols = SCIProwGetNNonz(row);
-
-               if ( i == consdata->i && j == consdata->j )
-               {
-                  /* i and j play against each other.
-                   * On all rounds other than round consdata->r, the y-variables must be disabled. */
-                  for (c = 0; c < ncols; ++c)
-                  {
-                     /* we stored the round of the variable in its vardata */
-                     var = SCIPcolGetVar(cols[c]);
-                     r = (int) (long) SCIPvarGetData(var);
-                     if ( r != consdata->r )
-                     {
-                        if ( SCIPisGT(scip, SCIPvarGetUbLocal(var), 0.0) )
-                        {
-                           *result = SCIP_REDUCEDDOM;
-                           SCIPchgVarUb(scip, var, 0.0);
-                        }
-                     }
-                  }
-               }
-               else if ( i == consdata->i || j == consdata->j )
-               {
-                  /* i and j have a different opponent in this matching. Disable y-variables on round r. */
-                  for (c = 0; c < ncols; ++c)
-                  {
-                     /* we stored the round of the variable in its vardata */
-                     var = SCIPcolGetVar(cols[c]);
-                     r = (int) (long) SCIPvarGetData(var);
-                     if ( r == consdata->r )
-                     {
-                        if ( SCIPisGT(scip, SCIPvarGetUbLocal(var), 0.0) )
-                        {
-                           *result = SCIP_REDUCEDDOM;
-                           SCIPchgVarUb(scip, var, 0.0);
-                        }
-                     }
-                  }
-               }
-            }
-         }
-      }
-      else
+   for (v = 0; v < nvars; ++v)
+   {
+      if ( !SCIPisGT(scip, SCIPvarGetUbLocal(vars[v]), 0.0) )
+         continue;
+
+      /* the variable data holds the round and the edge bitset of the matching; artificial columns have none */
+      vardata = SCIPvarGetData(vars[v]);
+      if ( vardata == NULL )
+         continue;
+      r = SCIPvardataGetRoundSRR(vardata);
+      if ( !conshdlrdata->roundchanged[r] )
+         continue;
+
+      if ( !SCIPvardataIsAllowedSRR(vardata, &conshdlrdata->allowededges[r * conshdlrdata->nwords]) )
       {
-         /* team i must not play against team j in round r. */
-         k = -1;
-         for (i = 0; i < nteams; ++i)
-         {
-            for (j = i + 1; j < nteams; ++j)
-            {
-               ++k;
-
-               SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchisplayed[k], &cons) );
-               row = SCIPconsGetRow(scip, cons);
-               cols = SCIProwGetCols(row);
-               ncols = SCIProwGetNNonz(row);
-
-               if ( i == consdata->i && j == consdata->j )
-               {
-                  /* i and j play against each other.
-                   * On round r, these y-variables must be disabled. */
-                  for (c = 0; c < ncols; ++c)
-                  {
-                     /* we stored the round of the variable in its vardata */
-                     var = SCIPcolGetVar(cols[c]);
-                     r = (int) (long) SCIPvarGetData(var);
-                     if ( r == consdata->r )
-                     {
-                        if ( SCIPisGT(scip, SCIPvarGetUbLocal(var), 0.0) )
-                        {
-                           SCIPchgVarUb(scip, var, 0.0);
-                           *result = SCIP_REDUCEDDOM;
-                        }
-                     }
-                  }
-               }
-            }
-         }
+         SCIP_CALL( SCIPchgVarUb(scip, vars[v], 0.0) );
+         *result = SCIP_REDUCEDDOM;
       }
    }
 
+   BMSclearMemoryArray(conshdlrdata->roundchanged, conshdlrdata->nrounds);
+   conshdlrdata->anychanged = FALSE;
+
    return SCIP_OKAY;
 }/*lint !e715*/
 
@@ -337,17 +490,58 @@ SCIP_RETCODE SCIPcreateConsSRRmor(
    return SCIP_OKAY;
 }
 
+/** returns the bitsets of the edges that are allowed and forced on round `round` at the current node
+ *
+ * The bitsets are maintained incrementally when SRR MOR constraints are (de)activated, and remain valid until the next
+ * change of the active constraints.
+ */
+SCIP_RETCODE SCIPgetRoundEdgesSRRmor(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   round,              /**< round */
+   const SRR_BITWORD**   allowededges,       /**< pointer to store the bitset of allowed edges */
+   const SRR_BITWORD**   forcededges         /**< pointer to store the bitset of forced edges, or NULL */
+)
+{
+   SCIP_CONSHDLR* conshdlr;
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( scip != NULL );
+   assert( allowededges != NULL );
+
+   conshdlr = SCIPfindConshdlr(scip, CONSHDLR_NAME);
+   if ( conshdlr == NULL )
+   {
+      SCIPerrorMessage("SRRMOR constraint handler not found\n");
+      return SCIP_PLUGINNOTFOUND;
+   }
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   assert( conshdlrdata->allowededges != NULL );
+   assert( round >= 0 && round < conshdlrdata->nrounds );
+
+   *allowededges = &conshdlrdata->allowededges[round * conshdlrdata->nwords];
+   if ( forcededges != NULL )
+      *forcededges = &conshdlrdata->forcededges[round * conshdlrdata->nwords];
+
+   return SCIP_OKAY;
+}
+
 /** creates the handler for SRR */
 SCIP_RETCODE SCIPincludeConshdlrSRR(
    SCIP*                 scip                /**< SCIP data structure */
 )
 {
    SCIP_CONSHDLR* conshdlr;
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   /* create constraint handler data */
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, &conshdlrdata) );
 
    /* include constraint handler */
    SCIP_CALL( SCIPincludeConshdlrBasic(scip, &conshdlr, CONSHDLR_NAME, CONSHDLR_DESC,
          CONSHDLR_ENFOPRIORITY, CONSHDLR_CHECKPRIORITY, CONSHDLR_EAGERFREQ, CONSHDLR_NEEDSCONS,
-         consEnfolpSRR, consEnfopsSRR, consCheckSRR, consLockSRR, NULL) );
+         consEnfolpSRR, consEnfopsSRR, consCheckSRR, consLockSRR, conshdlrdata) );
    assert(conshdlr != NULL);
 
    /* set non-fundamental callbacks via specific setter functions */
@@ -355,6 +549,10 @@ SCIP_RETCODE SCIPincludeConshdlrSRR(
       CONSHDLR_PROP_TIMING) );
    SCIP_CALL( SCIPsetConshdlrFree(scip, conshdlr, consFreeSRR) );
    SCIP_CALL( SCIPsetConshdlrDelete(scip, conshdlr, consDeleteSRR) );
+   SCIP_CALL( SCIPsetConshdlrInitsol(scip, conshdlr, consInitsolSRR) );
+   SCIP_CALL( SCIPsetConshdlrExitsol(scip, conshdlr, consExitsolSRR) );
+   SCIP_CALL( SCIPsetConshdlrActive(scip, conshdlr, consActiveSRR) );
+   SCIP_CALL( SCIPsetConshdlrDeactive(scip, conshdlr, consDeactiveSRR) );
 
    return SCIP_OKAY;
 }
@@ -21,6 +21,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include "scip/scip.h"
+#include "bitset_srr.h"
 
 
 SCIP_RETCODE SCIPgetConstraintDataSRRmor(
@@ -44,6 +45,18 @@ SCIP_RETCODE SCIPcreateConsSRRmor(
 );
 
 
+/** returns the bitsets of the edges that are allowed and forced on round `round` at the current node
+ *
+ * The bitsets are maintained incrementally when SRR MOR constraints are (de)activated, and remain valid until the next
+ * change of the active constraints.
+ */
+SCIP_RETCODE SCIPgetRoundEdgesSRRmor(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   round,              /**< round */
+   const SRR_BITWORD**   allowededges,       /**< pointer to store the bitset of allowed edges */
+   const SRR_BITWORD**   forcededges         /**< pointer to store the bitset of forced edges, or NULL */
+);
+
 /** creates the handler for SRR */
 SCIP_RETCODE SCIPincludeConshdlrSRR(
    SCIP*                 scip                /**< SCIP data structure */
@@ -0,0 +1,202 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   lagrangian_srr.c
+ * @brief  subgradient method for the Lagrangian relaxation of the match-constraints of SRR
+ * @author Jasper van Doornmalen
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "probdata_srr.h"
+#include "lagrangian_srr.h"
+
+#define LAGRANGIAN_THETA       2.0           /**< initial factor of Polyak's step length */
+#define LAGRANGIAN_MINTHETA    1e-4          /**< factor of the step length below which the method stops */
+#define LAGRANGIAN_PATIENCE    5             /**< number of iterations without improvement before halving the factor */
+#define LAGRANGIAN_AVERAGING   0.7           /**< weight of the current subgradient in the direction */
+#define LAGRANGIAN_TARGETGAP   0.05          /**< relative distance of the target above the bound without upper bound */
+
+/** maximizes the Lagrangian bound by deflected subgradient steps, starting from the multipliers in mu */
+SCIP_RETCODE SCIPlagrangianSolveSRR(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SRR_THREADPOOL*       threadpool,         /**< thread pool for solving the rounds, or NULL */
+   SRR_MATCHING**        matchings,          /**< matching data of each round */
+   int                   nteams,             /**< number of teams */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            coefs,              /**< cost coefficients of the problem */
+   const SRR_BITWORD*    edgeexists,         /**< bitsets of the edges that may be used on each round */
+   SCIP_Bool             nonnegative,        /**< must the multipliers be non-negative (covering match rows)? */
+   int                   maxiters,           /**< maximal number of iterations */
+   SCIP_Real             upperbound,         /**< objective value of a known schedule, or infinity */
+   SCIP_Real*            mu,                 /**< starting multipliers of the match-constraints; the best on return */
+   SCIP_Real*            roundduals,         /**< array to store the round duals that belong to the best multipliers */
+   SCIP_Real*            bound,              /**< pointer to store the best Lagrangian bound */
+   int*                  niters              /**< pointer to store the number of iterations */
+)
+{
+   SCIP_Real* current;
+   SCIP_Real* direction;
+   SCIP_Real* weights;
+   SCIP_Real* minvalues;
+   SCIP_Real* solutionvalues;
+   SCIP_Real value;
+   SCIP_Real target;
+   SCIP_Real theta;
+   SCIP_Real norm;
+   SCIP_Real step;
+   int* nsols;
+   int* solutions;
+   int* count;
+   int noimprovement;
+   int nedges;
+   int i;
+   int j;
+   int k;
+   int r;
+
+   assert( scip != NULL );
+   assert( matchings != NULL );
+   assert( mu != NULL );
+   assert( roundduals != NULL );
+   assert( bound != NULL );
+   assert( niters != NULL );
+
+   nedges = (nteams / 2) * (nteams - 1);
+
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &current, mu, nedges) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &direction, nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &weights, nrounds * nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &minvalues, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solutionvalues, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nsols, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solutions, nrounds * nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &count, nedges) );
+
+   for (r = 0; r < nrounds; ++r)
+      minvalues[r] = -SCIPinfinity(scip);
+
+   *bound = -SCIPinfinity(scip);
+   theta = LAGRANGIAN_THETA;
+   noimprovement = 0;
+
+   *niters = 0;
+   while ( *niters < maxiters && theta >= LAGRANGIAN_MINTHETA )
+   {
+      ++(*niters);
+
+      /* the matching weights of the rounds for the current multipliers */
+      for (r = 0; r < nrounds; ++r)
+      {
+         for (i = 0; i < nteams; ++i)
+         {
+            for (j = i + 1; j < nteams; ++j)
+            {
+               k = SCIPmatchGetIndex(nteams, i, j);
+               weights[r * nedges + k] = current[k] - coefs[j + i * nteams + r * nteams * nteams];
+            }
+         }
+      }
+
+      SCIPmatchingSolveRoundsSRR(threadpool, matchings, nrounds, 1, weights, edgeexists, minvalues, NULL, nsols,
+         solutionvalues, solutions);
+
+      value = 0.0;
+      for (k = 0; k < nedges; ++k)
+         value += current[k];
+      for (r = 0; r < nrounds; ++r)
+      {
+         /* without a perfect matching on some round, there is no schedule at all */
+         if ( nsols[r] == 0 )
+         {
+            *bound = SCIPinfinity(scip);
+            break;
+         }
+         value -= solutionvalues[r];
+      }
+      if ( r < nrounds )
+         break;
+
+      if ( SCIPisGT(scip, value, *bound) )
+         noimprovement = 0;
+      else if ( ++noimprovement >= LAGRANGIAN_PATIENCE )
+      {
+         theta /= 2.0;
+         noimprovement = 0;
+      }
+
+      if ( value > *bound )
+      {
+         *bound = value;
+         BMScopyMemoryArray(mu, current, nedges);
+         for (r = 0; r < nrounds; ++r)
+            roundduals[r] = -solutionvalues[r];
+      }
+
+      /* the bound already proves that no schedule is better than the known one */
+      if ( !SCIPisInfinity(scip, upperbound) && SCIPisGE(scip, *bound, upperbound) )
+         break;
+
+      /* the subgradient of match k is 1 minus the number of rounds that play k */
+      BMSclearMemoryArray(count, nedges);
+      for (r = 0; r < nrounds; ++r)
+      {
+         for (i = 0; i < nteams; ++i)
+         {
+            j = solutions[r * nteams + i];
+            if ( i < j )
+               ++count[SCIPmatchGetIndex(nteams, i, j)];
+         }
+      }
+
+      norm = 0.0;
+      for (k = 0; k < nedges; ++k)
+      {
+         direction[k] = LAGRANGIAN_AVERAGING * (1.0 - count[k]) + (1.0 - LAGRANGIAN_AVERAGING) * direction[k];
+
+         /* a step that would only make a multiplier more negative does not move it */
+         if ( nonnegative && current[k] <= 0.0 && direction[k] < 0.0 )
+            direction[k] = 0.0;
+         norm += direction[k] * direction[k];
+      }
+
+      /* a zero subgradient means that the matchings form a schedule, whose cost is the bound */
+      if ( SCIPisZero(scip, norm) )
+         break;
+
+      target = SCIPisInfinity(scip, upperbound) ? *bound + LAGRANGIAN_TARGETGAP * MAX(1.0, REALABS(*bound)) : upperbound;
+      step = theta * (target - value) / norm;
+      for (k = 0; k < nedges; ++k)
+      {
+         current[k] += step * direction[k];
+         if ( nonnegative )
+            current[k] = MAX(current[k], 0.0);
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &count);
+   SCIPfreeBufferArray(scip, &solutions);
+   SCIPfreeBufferArray(scip, &nsols);
+   SCIPfreeBufferArray(scip, &solutionvalues);
+   SCIPfreeBufferArray(scip, &minvalues);
+   SCIPfreeBufferArray(scip, &weights);
+   SCIPfreeBufferArray(scip, &direction);
+   SCIPfreeBufferArray(scip, &current);
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,66 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   lagrangian_srr.h
+ * @brief  subgradient method for the Lagrangian relaxation of the match-constraints of SRR
+ * @author Jasper van Doornmalen
+ *
+ * Relaxing the match-constraints with multipliers mu splits the master problem into one matching problem per round.
+ * The Lagrangian bound is L(mu) = sum_k mu_k - sum_r max_M sum_{k in M} (mu_k - c_rk), and (pi, mu) with pi_r the
+ * negated optimal matching weight of round r is a feasible dual solution of the master LP of value L(mu).
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SRR_LAGRANGIAN_H__
+#define __SRR_LAGRANGIAN_H__
+
+#include "scip/scip.h"
+#include "bitset_srr.h"
+#include "lemon_wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** maximizes the Lagrangian bound by deflected subgradient steps, starting from the multipliers in mu
+ *
+ * The step length follows Polyak's rule towards upperbound, or towards a target a bit above the best bound if no
+ * upper bound is known, and is halved whenever the bound did not improve for a few iterations. The direction averages
+ * the current and the previous subgradient, as in the volume algorithm. On return, mu and roundduals hold the best dual
+ * solution found. If some round has no perfect matching on its edges, the bound is infinity.
+ */
+SCIP_RETCODE SCIPlagrangianSolveSRR(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SRR_THREADPOOL*       threadpool,         /**< thread pool for solving the rounds, or NULL */
+   SRR_MATCHING**        matchings,          /**< matching data of each round */
+   int                   nteams,             /**< number of teams */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            coefs,              /**< cost coefficients of the problem */
+   const SRR_BITWORD*    edgeexists,         /**< bitsets of the edges that may be used on each round */
+   SCIP_Bool             nonnegative,        /**< must the multipliers be non-negative (covering match rows)? */
+   int                   maxiters,           /**< maximal number of iterations */
+   SCIP_Real             upperbound,         /**< objective value of a known schedule, or infinity */
+   SCIP_Real*            mu,                 /**< starting multipliers of the match-constraints; the best on return */
+   SCIP_Real*            roundduals,         /**< array to store the round duals that belong to the best multipliers */
+   SCIP_Real*            bound,              /**< pointer to store the best Lagrangian bound */
+   int*                  niters              /**< pointer to store the number of iterations */
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -20,87 +20,1166 @@
 
 /*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cassert>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <memory>
 #include <iostream>
-#include <lemon/smart_graph.h>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <thread>
+#include <lemon/full_graph.h>
+#include <lemon/adaptors.h>
 #include <lemon/matching.h>
 
 #include "lemon_wrapper.h"
+#include "matching_dense.h"
 
 #include <vector>
 
-#ifdef __cplusplus
-  extern "C" {
+typedef lemon::FullGraph::EdgeMap<double> WeightMap;
+typedef lemon::FullGraph::EdgeMap<bool> EdgeFilter;
+typedef lemon::FilterEdges<const lemon::FullGraph, EdgeFilter> SubGraph;
+typedef lemon::MaxWeightedPerfectMatching<SubGraph, WeightMap> PerfectMatching;
+
+/** LEMON matching problem on the complete graph with a fixed number of vertices
+ *
+ * The edges that may not be used are hidden by an edge filter, so that per solve only the weights and the filter are
+ * rewritten. The matching algorithm keeps its data structures between runs.
+ */
+struct MatchingGraph
+{
+   lemon::FullGraph graph;
+   std::vector<lemon::FullGraph::Edge> edges;  /**< the edges {a, b} with a < b, sorted by a and then by b */
+   WeightMap weights;
+   EdgeFilter edgeexists;
+   SubGraph subgraph;
+   PerfectMatching mwpm;
+
+   MatchingGraph(int n) :
+      graph(n),
+      weights(graph, 0.0),
+      edgeexists(graph, false),
+      subgraph(graph, edgeexists),
+      mwpm(subgraph, weights)
+   {
+      int a;
+      int b;
+
+      edges.reserve((n * (n - 1)) / 2);
+      for (a = 0; a < n; ++a)
+      {
+         for (b = a + 1; b < n; ++b)
+            edges.push_back(graph.edge(graph(a), graph(b)));
+      }
+   }
+};
+
+/** maximal number of remaining teams that the automatic engine solves by dynamic programming over subsets
+ *
+ * Measured on complete graphs with random weights: the DP takes 0.1, 0.6 and 5.2 us on 4, 6 and 8 teams against 0.6,
+ * 2.1 and 5.8 us for the dense kernel, but 42 us against 10 us on 10 teams, and 3.6 ms against 31 us on 16 teams.
+ */
+#define SRR_SUBSETDP_MAXTEAMS 8
+
+/** persistent data for solving the matching problems of one round
+ *
+ * Before solving, the teams that have only one usable edge left are matched along it, which repeatedly shrinks the
+ * problem; in particular, this contracts the edges forced by branching. Only the remaining teams are passed to the
+ * engine: LEMON on a graph of the remaining size, the dense blossom kernel of that size, or the subset DP for at most
+ * SRR_SUBSETDP_MAXTEAMS teams. Graphs and kernels are built on first use and kept for later solves.
+ */
+struct SRR_Matching
+{
+   int nteams;
+   int nedges;
+   std::vector<int> edgeindex;                 /**< index of edge {i, j} at i * nteams + j and j * nteams + i */
+   std::vector<int> edgeteams;                 /**< the teams of edge k at 2k and 2k + 1 */
+   std::vector<int> lastsolution;              /**< optimal matching of the last exact solve, or empty */
+   const double* weights;                      /**< edge weights of the current solve, in the order of edgeindex */
+   std::vector<std::unique_ptr<MatchingGraph> > graphs; /**< matching problem on m vertices at index m, or NULL */
+   std::vector<int> degree;                    /**< buffer for the number of usable edges of each team */
+   std::vector<int> vertices;                  /**< buffer for the teams that remain after shrinking */
+   std::vector<int> stack;                     /**< buffer for the teams that have at most one usable edge */
+   char engine;                                /**< matching engine: 'l'emon, 'd'ense, or 'a'uto */
+   std::vector<std::unique_ptr<DenseMatchingBase> > dense; /**< dense kernel of a fixed size at index m, generic at 0 */
+   std::vector<double> localweights;           /**< buffer for the weight matrix of the remaining teams */
+   std::vector<unsigned char> localexists;     /**< buffer for the edge matrix of the remaining teams */
+   std::vector<int> localmate;                 /**< buffer for the mates of the remaining teams */
+   std::vector<double> dpvalue;                /**< best matching weight of each subset in the subset DP */
+   std::vector<signed char> dpchoice;          /**< mate of the lowest vertex of each subset in the subset DP, or -1 */
+   std::vector<int> order;                     /**< buffer for the usable edges sorted by weight in the greedy */
+   std::vector<int> greedy;                    /**< buffer for the greedy matching of the heuristic */
+
+   SRR_Matching(int n) :
+      nteams(n),
+      nedges((n / 2) * (n - 1)),
+      weights(NULL),
+      graphs(n + 1),
+      engine('a'),
+      dense(n + 1)
+   {
+      int i;
+      int j;
+      int k;
+
+      edgeindex.assign(nteams * nteams, -1);
+      edgeteams.resize(2 * nedges);
+      order.reserve(nedges);
+      greedy.resize(nteams);
+      k = 0;
+      for (i = 0; i < nteams; ++i)
+      {
+         for (j = i + 1; j < nteams; ++j)
+         {
+            edgeindex[i * nteams + j] = k;
+            edgeindex[j * nteams + i] = k;
+            edgeteams[2 * k] = i;
+            edgeteams[2 * k + 1] = j;
+            ++k;
+         }
+      }
+   }
+};
+
+/** a subproblem of the k-best enumeration: the optimal matching among the edges of a mask */
+struct MatchingCandidate
+{
+   double value;
+   std::vector<SRR_BITWORD> mask;
+   std::vector<int> solution;
+
+   bool operator<(const MatchingCandidate& other) const
+   {
+      return value < other.value;
+   }
+};
+
+/** solves the matching problem on the remaining teams matching->vertices with LEMON
+ *
+ * Returns false if no perfect matching exists; otherwise, the mates are stored as indices into matching->vertices.
+ */
+static
+bool solveLemon(
+   SRR_MATCHING*         matching,           /**< matching data, with the remaining teams in vertices */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   int*                  localmate           /**< array to store the mate of each remaining team */
+)
+{
+   const std::vector<int>& vertices = matching->vertices;
+   int m = (int) vertices.size();
+   int a;
+   int b;
+   int k;
+   int t;
+
+   if( !matching->graphs[m] )
+      matching->graphs[m].reset(new MatchingGraph(m));
+   MatchingGraph& graph = *matching->graphs[m];
+
+   k = 0;
+   for (a = 0; a < m; ++a)
+   {
+      for (b = a + 1; b < m; ++b)
+      {
+         t = matching->edgeindex[vertices[a] * matching->nteams + vertices[b]];
+         graph.weights[graph.edges[k]] = matching->weights[t];
+         graph.edgeexists[graph.edges[k]] = SRRbitsetIsSet(edgeexists, t);
+         ++k;
+      }
+   }
+
+   // Compute max. weight perfect matching
+   if( !graph.mwpm.run() )
+      return false;
+
+   for (a = 0; a < m; ++a)
+      localmate[a] = graph.graph.index(graph.mwpm.mate(graph.graph(a)));
+
+   return true;
+}
+
+/** returns the dense kernel for m vertices; the common sizes have their own instantiation */
+static
+DenseMatchingBase* getDenseKernel(
+   SRR_MATCHING*         matching,           /**< matching data */
+   int                   m                   /**< number of vertices */
+)
+{
+   std::unique_ptr<DenseMatchingBase>& kernel = matching->dense[m];
+
+   if( !kernel )
+   {
+      switch( m )
+      {
+      case 8:
+         kernel.reset(new DenseBlossom<8>(m));
+         break;
+      case 10:
+         kernel.reset(new DenseBlossom<10>(m));
+         break;
+      case 12:
+         kernel.reset(new DenseBlossom<12>(m));
+         break;
+      case 14:
+         kernel.reset(new DenseBlossom<14>(m));
+         break;
+      case 16:
+         kernel.reset(new DenseBlossom<16>(m));
+         break;
+      case 18:
+         kernel.reset(new DenseBlossom<18>(m));
+         break;
+      case 20:
+         kernel.reset(new DenseBlossom<20>(m));
+         break;
+      case 22:
+         kernel.reset(new DenseBlossom<22>(m));
+         break;
+      case 24:
+         kernel.reset(new DenseBlossom<24>(m));
+         break;
+      default:
+         /* all other sizes share one kernel, at index 0, sized for all teams */
+         if( !matching->dense[0] )
+            matching->dense[0].reset(new DenseBlossom<0>(matching->nteams));
+         return matching->dense[0].get();
+      }
+   }
+
+   return kernel.get();
+}
+
+/** fills the weight and edge matrices of the remaining teams matching->vertices */
+static
+void fillLocalMatrices(
+   SRR_MATCHING*         matching,           /**< matching data, with the remaining teams in vertices */
+   const SRR_BITWORD*    edgeexists          /**< bitset of the edges that may be used */
+)
+{
+   const std::vector<int>& vertices = matching->vertices;
+   int m = (int) vertices.size();
+   int a;
+   int b;
+   int t;
+
+   matching->localweights.resize(m * m);
+   matching->localexists.resize(m * m);
+   for (a = 0; a < m; ++a)
+   {
+      matching->localexists[a * m + a] = 0;
+      for (b = a + 1; b < m; ++b)
+      {
+         t = matching->edgeindex[vertices[a] * matching->nteams + vertices[b]];
+         matching->localweights[a * m + b] = matching->localweights[b * m + a] = matching->weights[t];
+         matching->localexists[a * m + b] = matching->localexists[b * m + a] = SRRbitsetIsSet(edgeexists, t) ? 1 : 0;
+      }
+   }
+}
+
+/** solves the matching problem on the remaining teams matching->vertices with the dense kernel
+ *
+ * Returns false if no perfect matching exists; otherwise, the mates are stored as indices into matching->vertices.
+ */
+static
+bool solveDense(
+   SRR_MATCHING*         matching,           /**< matching data, with the remaining teams in vertices */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   int*                  localmate           /**< array to store the mate of each remaining team */
+)
+{
+   int m = (int) matching->vertices.size();
+
+   fillLocalMatrices(matching, edgeexists);
+
+   return getDenseKernel(matching, m)->solve(m, matching->localweights.data(), matching->localexists.data(), localmate);
+}
+
+/** solves the matching problem on the remaining teams matching->vertices by dynamic programming over subsets
+ *
+ * The best matching of a subset S pairs the lowest vertex of S with some other vertex of S, and matches the rest of S
+ * optimally. The subsets are processed in increasing order of their bitmask, so all smaller subsets are done. Subsets
+ * of odd size have no perfect matching and are never the rest of an even subset, so they are skipped. This takes
+ * O(2^m m) time and flat arrays only, which is faster than the dense kernel only on very few teams, see
+ * SRR_SUBSETDP_MAXTEAMS.
+ *
+ * Returns false if no perfect matching exists; otherwise, the mates are stored as indices into matching->vertices.
+ */
+static
+bool solveSubsetDP(
+   SRR_MATCHING*         matching,           /**< matching data, with the remaining teams in vertices */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   int*                  localmate           /**< array to store the mate of each remaining team */
+)
+{
+   std::vector<double>& value = matching->dpvalue;
+   std::vector<signed char>& choice = matching->dpchoice;
+   const double* weights;
+   const unsigned char* exists;
+   unsigned int nsubsets;
+   unsigned int subset;
+   unsigned int rest;
+   double best;
+   int m = (int) matching->vertices.size();
+   int low;
+   int a;
+   int b;
+
+   assert( m <= SRR_SUBSETDP_MAXTEAMS );
+
+   fillLocalMatrices(matching, edgeexists);
+   weights = matching->localweights.data();
+   exists = matching->localexists.data();
+
+   nsubsets = 1u << m;
+   value.resize(nsubsets);
+   choice.resize(nsubsets);
+
+   value[0] = 0.0;
+   choice[0] = -1;
+   for (subset = 1; subset < nsubsets; ++subset)
+   {
+      if( std::bitset<32>(subset).count() % 2 != 0 )
+         continue;
+
+      for (low = 0; !(subset & (1u << low)); ++low)
+         ;
+
+      best = -std::numeric_limits<double>::infinity();
+      choice[subset] = -1;
+      for (b = low + 1; b < m; ++b)
+      {
+         if( !(subset & (1u << b)) || !exists[low * m + b] )
+            continue;
+
+         rest = subset & ~(1u << low) & ~(1u << b);
+         if( choice[rest] < 0 && rest != 0 )
+            continue;
+
+         if( choice[subset] < 0 || value[rest] + weights[low * m + b] > best )
+         {
+            best = value[rest] + weights[low * m + b];
+            choice[subset] = (signed char) b;
+         }
+      }
+      value[subset] = best;
+   }
+
+   subset = nsubsets - 1;
+   if( choice[subset] < 0 )
+      return false;
+
+   /* follow the choices from the full set down */
+   while( subset != 0 )
+   {
+      for (a = 0; !(subset & (1u << a)); ++a)
+         ;
+      b = choice[subset];
+      assert( b > a );
+      localmate[a] = b;
+      localmate[b] = a;
+      subset &= ~(1u << a) & ~(1u << b);
+   }
+
+   return true;
+}
+
+/** returns the function that solves a matching problem on m remaining teams with the selected engine */
+static
+bool (*getKernel(
+   SRR_MATCHING*         matching,           /**< matching data */
+   int                   m                   /**< number of remaining teams */
+))(SRR_MATCHING*, const SRR_BITWORD*, int*)
+{
+   switch( matching->engine )
+   {
+   case 'l':
+      return solveLemon;
+   case 'd':
+      return solveDense;
+   default:
+      return m <= SRR_SUBSETDP_MAXTEAMS ? solveSubsetDP : solveDense;
+   }
+}
+
+#ifdef SRR_CHECK_MATCHING
+/** checks that the solution of the selected engine has the weight of the other engine's solution */
+static
+void checkKernels(
+   SRR_MATCHING*         matching,           /**< matching data, with the remaining teams in vertices */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   const int*            localmate           /**< mates of the remaining teams found by the selected engine */
+)
+{
+   const std::vector<int>& vertices = matching->vertices;
+   std::vector<int> othermate(vertices.size());
+   double value = 0.0;
+   double othervalue = 0.0;
+   bool otherfeasible;
+   int a;
+
+   otherfeasible = (matching->engine == 'l' ? solveDense : solveLemon)(matching, edgeexists, othermate.data());
+   assert( otherfeasible );
+
+   for (a = 0; a < (int) vertices.size(); ++a)
+   {
+      if( a < localmate[a] )
+         value += matching->weights[matching->edgeindex[vertices[a] * matching->nteams + vertices[localmate[a]]]];
+      if( a < othermate[a] )
+         othervalue += matching->weights[matching->edgeindex[vertices[a] * matching->nteams + vertices[othermate[a]]]];
+   }
+
+   if( !otherfeasible || std::abs(value - othervalue) > 1e-6 * std::max(1.0, std::abs(value)) )
+   {
+      std::cerr << "matching engines disagree: " << value << " vs. " << othervalue << std::endl;
+      abort();
+   }
+}
 #endif
 
-void SCIPmatchingSolveSRR(
-   int nteams,
-   double* weights,
-   unsigned int* edgeexists,
-   double* solutionvalue,
-   int* solution
+/** computes a maximum weight perfect matching on the edges of the mask, using the weights of the current solve
+ *
+ * Teams with a single usable edge are matched along it first, and their edges are removed; this is repeated until
+ * every team has at least two usable edges. The rest is solved by the selected engine on the remaining teams only.
+ * Returns false if no perfect matching exists.
+ */
+static
+bool solveMasked(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   double*               solutionvalue,      /**< pointer to store the weight of the matching */
+   int*                  solution            /**< array to store the opponent of each team */
 )
 {
+   std::vector<int>& degree = matching->degree;
+   std::vector<int>& vertices = matching->vertices;
+   std::vector<int>& stack = matching->stack;
+   std::vector<int>& localmate = matching->localmate;
+   const int* edgeindex = matching->edgeindex.data();
+   int nteams = matching->nteams;
+   int m;
+   int a;
    int i;
    int j;
    int k;
-   int nodeid;
+   int t;
 
-   std::vector<lemon::SmartGraphBase::Node> nodes;
+   *solutionvalue = 0.0;
+   std::fill(solution, solution + nteams, -1);
 
-   // assert( weights != NULL );
-   // assert( edgeexists != NULL );
+   degree.assign(nteams, 0);
+   for (k = 0; k < matching->nedges; ++k)
+   {
+      if( SRRbitsetIsSet(edgeexists, k) )
+      {
+         ++degree[matching->edgeteams[2 * k]];
+         ++degree[matching->edgeteams[2 * k + 1]];
+      }
+   }
 
-   lemon::SmartGraph sgr;
-   lemon::SmartGraph::EdgeMap<double> scost(sgr);
+   stack.clear();
+   for (i = 0; i < nteams; ++i)
+   {
+      if( degree[i] <= 1 )
+         stack.push_back(i);
+   }
+
+   /* match the teams with only one usable edge along that edge */
+   while( !stack.empty() )
+   {
+      i = stack.back();
+      stack.pop_back();
+
+      if( solution[i] >= 0 )
+         continue;
+      if( degree[i] == 0 )
+         return false;
+
+      for (j = 0; j < nteams; ++j)
+      {
+         if( j != i && solution[j] < 0 && SRRbitsetIsSet(edgeexists, edgeindex[i * nteams + j]) )
+            break;
+      }
+      assert( j < nteams );
 
+      solution[i] = j;
+      solution[j] = i;
+
+      /* the edges to i and j cannot be used anymore */
+      for (t = 0; t < nteams; ++t)
+      {
+         if( solution[t] >= 0 )
+            continue;
+         if( SRRbitsetIsSet(edgeexists, edgeindex[t * nteams + i]) )
+            --degree[t];
+         if( SRRbitsetIsSet(edgeexists, edgeindex[t * nteams + j]) )
+            --degree[t];
+         if( degree[t] <= 1 )
+            stack.push_back(t);
+      }
+   }
+
+   vertices.clear();
    for (i = 0; i < nteams; ++i)
    {
-      lemon::SmartGraphBase::Node mynode;
-      mynode = sgr.addNode();
-      nodes.push_back(mynode);
+      if( solution[i] < 0 )
+         vertices.push_back(i);
    }
 
-   k = -1;
+   m = (int) vertices.size();
+   if( m > 0 )
+   {
+      localmate.resize(m);
+      if( !getKernel(matching, m)(matching, edgeexists, localmate.data()) )
+         return false;
+
+#ifdef SRR_CHECK_MATCHING
+      checkKernels(matching, edgeexists, localmate.data());
+#endif
+
+      /* translate the vertices back to teams */
+      for (a = 0; a < m; ++a)
+         solution[vertices[a]] = vertices[localmate[a]];
+   }
+
+   /* the weight is recomputed from the mates, independent of the engine */
    for (i = 0; i < nteams; ++i)
    {
-      for (j = i + 1; j < nteams; ++j)
+      if( i < solution[i] )
+         *solutionvalue += matching->weights[edgeindex[i * nteams + solution[i]]];
+   }
+
+   return true;
+}
+
+/** improves a perfect matching by 2-opt swaps: replace matched edges {a, b}, {c, d} by {a, c}, {b, d} or {a, d}, {b, c}
+ *
+ * Returns the weight of the improved matching.
+ */
+static
+double improveTwoOpt(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const double*         weights,            /**< edge weights, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   int*                  solution            /**< perfect matching to improve */
+)
+{
+   const int* edgeindex = matching->edgeindex.data();
+   int nteams = matching->nteams;
+   double value;
+   double current;
+   double swapped;
+   bool improved;
+   int a;
+   int b;
+   int c;
+   int d;
+   int e1;
+   int e2;
+
+   value = 0.0;
+   for (a = 0; a < nteams; ++a)
+   {
+      if( a < solution[a] )
+         value += weights[edgeindex[a * nteams + solution[a]]];
+   }
+
+   do
+   {
+      improved = false;
+      for (a = 0; a < nteams; ++a)
       {
-         ++k;
-         /* edgeexists and weights arrays follow the natural unordered edge sorting,
-          * that (i,j) < (i',j') if i < i', or i = i' and j < j'.
-          */
-         if( !edgeexists[k] )
+         b = solution[a];
+         if( b < a )
             continue;
 
-         lemon::SmartGraph::Edge e =
-            sgr.addEdge(sgr.nodeFromId(i), sgr.nodeFromId(j));
+         for (c = a + 1; c < nteams; ++c)
+         {
+            d = solution[c];
+            if( c == b || d < c )
+               continue;
+
+            current = weights[edgeindex[a * nteams + b]] + weights[edgeindex[c * nteams + d]];
+
+            /* swap to {a, c}, {b, d} */
+            e1 = edgeindex[a * nteams + c];
+            e2 = edgeindex[b * nteams + d];
+            if( SRRbitsetIsSet(edgeexists, e1) && SRRbitsetIsSet(edgeexists, e2) )
+            {
+               swapped = weights[e1] + weights[e2];
+               if( swapped > current + 1e-12 )
+               {
+                  solution[a] = c;
+                  solution[c] = a;
+                  solution[b] = d;
+                  solution[d] = b;
+                  value += swapped - current;
+                  improved = true;
+                  break;
+               }
+            }
 
-         scost[e] = weights[k];
+            /* swap to {a, d}, {b, c} */
+            e1 = edgeindex[a * nteams + d];
+            e2 = edgeindex[b * nteams + c];
+            if( SRRbitsetIsSet(edgeexists, e1) && SRRbitsetIsSet(edgeexists, e2) )
+            {
+               swapped = weights[e1] + weights[e2];
+               if( swapped > current + 1e-12 )
+               {
+                  solution[a] = d;
+                  solution[d] = a;
+                  solution[b] = c;
+                  solution[c] = b;
+                  value += swapped - current;
+                  improved = true;
+                  break;
+               }
+            }
+         }
       }
    }
+   while( improved );
 
-   // Compute min. cost perfect matching
-   lemon::MaxWeightedPerfectMatching<lemon::SmartGraph, lemon::SmartGraph::EdgeMap<double>>
-      mwpm(sgr, scost);
-   mwpm.run();
+   return value;
+}
 
-   *solutionvalue = (double) mwpm.matchingWeight();
+/** builds a perfect matching greedily by taking the heaviest remaining edges; returns false if it gets stuck */
+static
+bool greedyMatching(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const double*         weights,            /**< edge weights, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   int*                  solution            /**< array to store the opponent of each team */
+)
+{
+   std::vector<int>& order = matching->order;
+   int nmatched;
+   int i;
+   int j;
+   int k;
 
-   //assert( SCIPisEQ(scip, mwpm.matchingWeight(), mwpm.dualValue()) );
+   order.clear();
+   for (k = 0; k < matching->nedges; ++k)
+   {
+      if( SRRbitsetIsSet(edgeexists, k) )
+         order.push_back(k);
+   }
+   std::sort(order.begin(), order.end(), [weights](int k1, int k2) { return weights[k1] > weights[k2]; });
 
-   /* retrieve the matching */
-   for (k = 0; k < nteams; ++k)
+   std::fill(solution, solution + matching->nteams, -1);
+   nmatched = 0;
+   for (k = 0; k < (int) order.size() && nmatched < matching->nteams; ++k)
    {
-      nodeid = sgr.id(mwpm.mate(nodes[k]));
-      /* this must be possible in a more efficient way ... */
-      for (i = 0; i < nteams; ++i)
+      i = matching->edgeteams[2 * order[k]];
+      j = matching->edgeteams[2 * order[k] + 1];
+      if( solution[i] >= 0 || solution[j] >= 0 )
+         continue;
+
+      solution[i] = j;
+      solution[j] = i;
+      nmatched += 2;
+   }
+
+   return nmatched == matching->nteams;
+}
+
+/** checks whether solution is a perfect matching on the edges in edgeexists */
+static
+bool isMaskedMatching(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   const int*            solution            /**< opponent of each team */
+)
+{
+   int i;
+
+   for (i = 0; i < matching->nteams; ++i)
+   {
+      if( solution[i] < 0 || solution[i] >= matching->nteams || solution[i] == i || solution[solution[i]] != i )
+         return false;
+      if( !SRRbitsetIsSet(edgeexists, matching->edgeindex[i * matching->nteams + solution[i]]) )
+         return false;
+   }
+
+   return true;
+}
+
+/** returns the number of edges of the mask incident to team i */
+static
+int maskDegree(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const SRR_BITWORD*    mask,               /**< bitset of edges */
+   int                   i                   /**< team */
+)
+{
+   int j;
+   int degree = 0;
+
+   for (j = 0; j < matching->nteams; ++j)
+   {
+      if( j != i && SRRbitsetIsSet(mask, matching->edgeindex[i * matching->nteams + j]) )
+         ++degree;
+   }
+
+   return degree;
+}
+
+/** restricts the mask such that edge {i, j} must be used: all other edges incident to i or j are removed */
+static
+void maskForceEdge(
+   SRR_MATCHING*         matching,           /**< matching data */
+   SRR_BITWORD*          mask,               /**< bitset of edges */
+   int                   i,                  /**< first team */
+   int                   j                   /**< second team */
+)
+{
+   int t;
+
+   for (t = 0; t < matching->nteams; ++t)
+   {
+      if( t != i )
+         SRRbitsetUnset(mask, matching->edgeindex[i * matching->nteams + t]);
+      if( t != j )
+         SRRbitsetUnset(mask, matching->edgeindex[j * matching->nteams + t]);
+   }
+   SRRbitsetSet(mask, matching->edgeindex[i * matching->nteams + j]);
+}
+
+/** partitions the matchings of a candidate's mask other than its solution (Murty), and queues the subproblems
+ *
+ * For the edges e_1, ..., e_m of the solution that are not forced by the mask, subproblem t excludes e_t and forces
+ * e_1, ..., e_{t-1}. Subproblems without a perfect matching of weight above minvalue are dropped.
+ */
+static
+void partitionCandidate(
+   SRR_MATCHING*         matching,           /**< matching data, with the weights set */
+   const MatchingCandidate& candidate,       /**< candidate to partition */
+   double                minvalue,           /**< only subproblems with weight above this value are queued */
+   std::priority_queue<MatchingCandidate>& queue /**< queue of subproblems */
+)
+{
+   std::vector<SRR_BITWORD> forced(candidate.mask);
+   int i;
+   int j;
+
+   for (i = 0; i < matching->nteams; ++i)
+   {
+      j = candidate.solution[i];
+      if( j < i )
+         continue;
+
+      /* excluding an edge whose endpoint has no other edge leaves no perfect matching */
+      if( maskDegree(matching, forced.data(), i) > 1 && maskDegree(matching, forced.data(), j) > 1 )
       {
-         if( sgr.id(nodes[i]) == nodeid )
-            break;
+         MatchingCandidate child;
+
+         child.mask = forced;
+         SRRbitsetUnset(child.mask.data(), matching->edgeindex[i * matching->nteams + j]);
+         child.solution.resize(matching->nteams);
+         if( solveMasked(matching, child.mask.data(), &child.value, child.solution.data()) && child.value > minvalue )
+            queue.push(child);
       }
-      // assert( i < nteams );
-      solution[k] = i;
+
+      maskForceEdge(matching, forced.data(), i, j);
+   }
+}
+
+
+/** worker threads for solving the matching problems of several rounds in parallel
+ *
+ * A batch of jobs is published under the mutex; the workers and the calling thread then take job indices from an
+ * atomic counter until all jobs are taken. The caller returns once every worker has finished the batch.
+ */
+struct SRR_Threadpool
+{
+   std::vector<std::thread> workers;
+   std::mutex mutex;
+   std::condition_variable wakeup;            /**< signals a new batch or stopping to the workers */
+   std::condition_variable finished;          /**< signals the caller that all workers finished the batch */
+   const std::function<void(int)>* job;       /**< job of the current batch */
+   int njobs;                                 /**< number of jobs in the current batch */
+   std::atomic<int> nextjob;                  /**< index of the next job to take */
+   int nbusy;                                 /**< number of workers that did not finish the current batch */
+   unsigned long batch;                       /**< number of the current batch */
+   bool stop;
+
+   SRR_Threadpool(int nthreads) :
+      job(NULL),
+      njobs(0),
+      nextjob(0),
+      nbusy(0),
+      batch(0),
+      stop(false)
+   {
+      int t;
+
+      for (t = 1; t < nthreads; ++t)
+         workers.push_back(std::thread(&SRR_Threadpool::work, this));
+   }
+
+   ~SRR_Threadpool()
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         stop = true;
+      }
+      wakeup.notify_all();
+      for (std::thread& worker : workers)
+         worker.join();
+   }
+
+   /** takes jobs of the current batch until none are left */
+   void process()
+   {
+      int i;
+
+      while( (i = nextjob.fetch_add(1)) < njobs )
+         (*job)(i);
+   }
+
+   /** main loop of a worker */
+   void work()
+   {
+      unsigned long seen = 0;
+
+      for (;;)
+      {
+         {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeup.wait(lock, [&]{ return stop || batch != seen; });
+            if( stop )
+               return;
+            seen = batch;
+         }
+
+         process();
+
+         {
+            std::lock_guard<std::mutex> lock(mutex);
+            if( --nbusy == 0 )
+               finished.notify_one();
+         }
+      }
+   }
+
+   /** runs f(0), ..., f(n - 1) on the workers and the calling thread */
+   void run(int n, const std::function<void(int)>& f)
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         job = &f;
+         njobs = n;
+         nextjob = 0;
+         nbusy = (int) workers.size();
+         ++batch;
+      }
+      wakeup.notify_all();
+
+      process();
+
+      std::unique_lock<std::mutex> lock(mutex);
+      finished.wait(lock, [&]{ return nbusy == 0; });
+      job = NULL;
+   }
+};
+
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+/** creates the data for solving matching problems on the complete graph on nteams teams */
+SCIP_RETCODE SCIPmatchingCreateSRR(
+   SRR_MATCHING**        matching,           /**< pointer to store the matching data */
+   int                   nteams              /**< number of teams */
+)
+{
+   try
+   {
+      *matching = new SRR_Matching(nteams);
+   }
+   catch( const std::bad_alloc& )
+   {
+      *matching = NULL;
+      return SCIP_NOMEMORY;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** selects the engine that solves the matching problems: 'l' for LEMON, 'd' for the dense blossom kernel, 'a' for
+ *  the subset DP on small problems and the dense kernel otherwise
+ */
+void SCIPmatchingSetEngineSRR(
+   SRR_MATCHING*         matching,           /**< matching data */
+   char                  engine              /**< matching engine */
+)
+{
+   assert( engine == 'l' || engine == 'd' || engine == 'a' );
+
+   matching->engine = engine;
+}
+
+/** frees the matching data */
+void SCIPmatchingFreeSRR(
+   SRR_MATCHING**        matching            /**< pointer to the matching data */
+)
+{
+   delete *matching;
+   *matching = NULL;
+}
+
+/** computes a maximum weight perfect matching on the edges in edgeexists
+ *
+ * Teams with a single usable edge, such as the endpoints of an edge forced by branching, are matched first; the
+ * remaining teams are solved on a smaller graph. The graphs and the algorithm's data structures are reused between
+ * calls. If no perfect matching exists, feasible is set to FALSE.
+ */
+void SCIPmatchingSolveSRR(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const double*         weights,            /**< edge weights, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   SCIP_Bool*            feasible,           /**< pointer to store whether a perfect matching exists */
+   double*               solutionvalue,      /**< pointer to store the weight of the matching */
+   int*                  solution            /**< array to store the opponent of each team */
+)
+{
+   // assert( matching != NULL );
+   // assert( weights != NULL );
+   // assert( edgeexists != NULL );
+
+   matching->weights = weights;
+   *feasible = solveMasked(matching, edgeexists, solutionvalue, solution) ? TRUE : FALSE;
+   if( *feasible )
+      matching->lastsolution.assign(solution, solution + matching->nteams);
+}
+
+/** computes up to maxsols perfect matchings on the edges in edgeexists in order of non-increasing weight
+ *
+ * The subsequent matchings are enumerated by Murty's partitioning of the remaining matchings, solving each subproblem
+ * on the same persistent graph. The first (optimal) matching is always returned if a perfect matching exists; the
+ * others only if their weight exceeds minvalue. The number of returned matchings is stored in nsols; it is zero if no
+ * perfect matching exists.
+ */
+void SCIPmatchingSolveKBestSRR(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const double*         weights,            /**< edge weights, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   int                   maxsols,            /**< maximal number of matchings to return */
+   double                minvalue,           /**< weight that the second and later matchings must exceed */
+   int*                  nsols,              /**< pointer to store the number of returned matchings */
+   double*               solutionvalues,     /**< array to store the weight of each matching */
+   int*                  solutions           /**< array to store the opponents of each matching, at s * nteams */
+)
+{
+   std::priority_queue<MatchingCandidate> queue;
+   MatchingCandidate candidate;
+   int nwords;
+   int nteams;
+
+   nteams = matching->nteams;
+   nwords = SRRbitsetNWords(matching->nedges);
+
+   matching->weights = weights;
+   if( !solveMasked(matching, edgeexists, &solutionvalues[0], &solutions[0]) )
+   {
+      *nsols = 0;
+      return;
+   }
+   *nsols = 1;
+   matching->lastsolution.assign(&solutions[0], &solutions[nteams]);
+
+   if( maxsols <= 1 || solutionvalues[0] <= minvalue )
+      return;
+
+   candidate.value = solutionvalues[0];
+   candidate.mask.assign(edgeexists, edgeexists + nwords);
+   candidate.solution.assign(&solutions[0], &solutions[nteams]);
+
+   partitionCandidate(matching, candidate, minvalue, queue);
+
+   while( *nsols < maxsols && !queue.empty() )
+   {
+      candidate = queue.top();
+      queue.pop();
+
+      solutionvalues[*nsols] = candidate.value;
+      std::copy(candidate.solution.begin(), candidate.solution.end(), &solutions[*nsols * nteams]);
+      ++(*nsols);
+
+      if( *nsols < maxsols )
+         partitionCandidate(matching, candidate, minvalue, queue);
+   }
+}
+
+/** computes a heavy perfect matching on the edges in edgeexists heuristically
+ *
+ * Two starting points are improved by 2-opt swaps: the optimal matching of the last exact solve, if it still only uses
+ * edges of edgeexists, and a greedy matching. The better result is returned. The heuristic may fail to find a perfect
+ * matching even if one exists; in that case found is set to FALSE.
+ */
+void SCIPmatchingHeuristicSRR(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const double*         weights,            /**< edge weights, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   SCIP_Bool*            found,              /**< pointer to store whether a perfect matching was found */
+   double*               solutionvalue,      /**< pointer to store the weight of the matching */
+   int*                  solution            /**< array to store the opponent of each team */
+)
+{
+   std::vector<int>& greedy = matching->greedy;
+   double value;
+
+   *found = FALSE;
+
+   if( !matching->lastsolution.empty() && isMaskedMatching(matching, edgeexists, matching->lastsolution.data()) )
+   {
+      std::copy(matching->lastsolution.begin(), matching->lastsolution.end(), solution);
+      *solutionvalue = improveTwoOpt(matching, weights, edgeexists, solution);
+      *found = TRUE;
+   }
+
+   if( greedyMatching(matching, weights, edgeexists, greedy.data()) )
+   {
+      value = improveTwoOpt(matching, weights, edgeexists, greedy.data());
+      if( !*found || value > *solutionvalue )
+      {
+         std::copy(greedy.begin(), greedy.end(), solution);
+         *solutionvalue = value;
+         *found = TRUE;
+      }
+   }
+}
+
+/** creates a thread pool; the calling thread takes part in the work, so nthreads - 1 workers are started */
+SCIP_RETCODE SCIPthreadpoolCreateSRR(
+   SRR_THREADPOOL**      threadpool,         /**< pointer to store the thread pool */
+   int                   nthreads            /**< total number of threads */
+)
+{
+   try
+   {
+      *threadpool = new SRR_Threadpool(nthreads);
+   }
+   catch( const std::exception& )
+   {
+      *threadpool = NULL;
+      return SCIP_ERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** stops the workers and frees the thread pool */
+void SCIPthreadpoolFreeSRR(
+   SRR_THREADPOOL**      threadpool          /**< pointer to the thread pool */
+)
+{
+   delete *threadpool;
+   *threadpool = NULL;
+}
+
+/** computes up to maxsols maximum weight perfect matchings for each of the nrounds rounds
+ *
+ * Round r uses matchings[r], the weights at r * nedges, the edge bitset at r * nwords and minvalues[r] (see
+ * SCIPmatchingSolveKBestSRR()). It stores the number of matchings in nsols[r], their weights at r * maxsols in
+ * solutionvalues and their opponents at r * maxsols * nteams in solutions. If threadpool is NULL, the rounds are solved
+ * one after another in the calling thread.
+ */
+void SCIPmatchingSolveRoundsSRR(
+   SRR_THREADPOOL*       threadpool,         /**< thread pool, or NULL */
+   SRR_MATCHING**        matchings,          /**< matching data of each round */
+   int                   nrounds,            /**< number of rounds */
+   int                   maxsols,            /**< maximal number of matchings per round */
+   const double*         weights,            /**< edge weights of each round */
+   const SRR_BITWORD*    edgeexists,         /**< bitsets of the edges that may be used on each round */
+   const double*         minvalues,          /**< weight that the second and later matchings of each round must exceed */
+   const SCIP_Bool*      skip,               /**< rounds that need not be solved, or NULL to solve all */
+   int*                  nsols,              /**< array to store the number of matchings of each round */
+   double*               solutionvalues,     /**< array to store the weights of the matchings of each round */
+   int*                  solutions           /**< array to store the opponents in the matchings of each round */
+)
+{
+   int r;
+   int nteams;
+   int nedges;
+   int nwords;
+
+   if( nrounds <= 0 )
+      return;
+
+   nteams = matchings[0]->nteams;
+   nedges = matchings[0]->nedges;
+   nwords = SRRbitsetNWords(nedges);
+
+   std::function<void(int)> solveround = [&](int round)
+   {
+      if( skip != NULL && skip[round] )
+      {
+         nsols[round] = 0;
+         return;
+      }
+      SCIPmatchingSolveKBestSRR(matchings[round], &weights[round * nedges], &edgeexists[round * nwords], maxsols,
+         minvalues[round], &nsols[round], &solutionvalues[round * maxsols], &solutions[round * maxsols * nteams]);
+   };
+
+   if( threadpool == NULL )
+   {
+      for (r = 0; r < nrounds; ++r)
+         solveround(r);
+   }
+   else
+      threadpool->run(nrounds, solveround);
+}
+
+/** runs SCIPmatchingHeuristicSRR() for each of the nrounds rounds
+ *
+ * Round r uses matchings[r], the weights at r * nedges and the edge bitset at r * nwords. It stores whether a matching
+ * was found in found[r], its weight in solutionvalues[r] and its opponents at r * nteams in solutions. If threadpool is
+ * NULL, the rounds are handled one after another in the calling thread.
+ */
+void SCIPmatchingHeuristicRoundsSRR(
+   SRR_THREADPOOL*       threadpool,         /**< thread pool, or NULL */
+   SRR_MATCHING**        matchings,          /**< matching data of each round */
+   int                   nrounds,            /**< number of rounds */
+   const double*         weights,            /**< edge weights of each round */
+   const SRR_BITWORD*    edgeexists,         /**< bitsets of the edges that may be used on each round */
+   SCIP_Bool*            found,              /**< array to store whether a matching was found for each round */
+   double*               solutionvalues,     /**< array to store the weight of the matching of each round */
+   int*                  solutions           /**< array to store the opponents in the matching of each round */
+)
+{
+   int r;
+   int nteams;
+   int nedges;
+   int nwords;
+
+   if( nrounds <= 0 )
+      return;
+
+   nteams = matchings[0]->nteams;
+   nedges = matchings[0]->nedges;
+   nwords = SRRbitsetNWords(nedges);
+
+   std::function<void(int)> heurround = [&](int round)
+   {
+      SCIPmatchingHeuristicSRR(matchings[round], &weights[round * nedges], &edgeexists[round * nwords], &found[round],
+         &solutionvalues[round], &solutions[round * nteams]);
+   };
+
+   if( threadpool == NULL )
+   {
+      for (r = 0; r < nrounds; ++r)
+         heurround(r);
    }
+   else
+      threadpool->run(nrounds, heurround);
 }
 
 #ifdef __cplusplus
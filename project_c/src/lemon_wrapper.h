@@ -20,16 +20,136 @@
 
 /*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
+#include "scip/type_retcode.h"
+#include "bitset_srr.h"
+
 #ifdef __cplusplus
   extern "C" {
 #endif
 
+/** persistent data for solving the matching problems of one round */
+typedef struct SRR_Matching SRR_MATCHING;
+
+/** creates the data for solving matching problems on the complete graph on nteams teams */
+SCIP_RETCODE SCIPmatchingCreateSRR(
+   SRR_MATCHING**        matching,           /**< pointer to store the matching data */
+   int                   nteams              /**< number of teams */
+);
+
+/** frees the matching data */
+void SCIPmatchingFreeSRR(
+   SRR_MATCHING**        matching            /**< pointer to the matching data */
+);
+
+/** selects the engine that solves the matching problems: 'l' for LEMON, 'd' for the dense blossom kernel, 'a' (the
+ *  default) for dynamic programming over subsets of teams on at most 8 teams and the dense kernel otherwise
+ *
+ * The dense kernel works on an adjacency matrix and has instantiations of fixed size for 8 to 24 teams; LEMON builds
+ * graph structures per size; the subset DP only uses flat arrays. All give matchings of the same weight.
+ */
+void SCIPmatchingSetEngineSRR(
+   SRR_MATCHING*         matching,           /**< matching data */
+   char                  engine              /**< matching engine */
+);
+
+/** computes a maximum weight perfect matching on the edges in edgeexists
+ *
+ * Teams with a single usable edge, such as the endpoints of an edge forced by branching, are matched first; the
+ * remaining teams are solved on a smaller graph. The graphs and the algorithm's data structures are reused between
+ * calls. If no perfect matching exists, feasible is set to FALSE.
+ */
 void SCIPmatchingSolveSRR(
-   int nteams,
-   double* weights,
-   unsigned int* edgeexists,
-   double* solutionvalue,
-   int* solution
+   SRR_MATCHING*         matching,           /**< matching data */
+   const double*         weights,            /**< edge weights, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   SCIP_Bool*            feasible,           /**< pointer to store whether a perfect matching exists */
+   double*               solutionvalue,      /**< pointer to store the weight of the matching */
+   int*                  solution            /**< array to store the opponent of each team */
+);
+
+/** computes up to maxsols perfect matchings on the edges in edgeexists in order of non-increasing weight
+ *
+ * The subsequent matchings are enumerated by Murty's partitioning of the remaining matchings, solving each subproblem
+ * on the same persistent graph. The first (optimal) matching is always returned if a perfect matching exists; the
+ * others only if their weight exceeds minvalue. The number of returned matchings is stored in nsols; it is zero if no
+ * perfect matching exists.
+ */
+void SCIPmatchingSolveKBestSRR(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const double*         weights,            /**< edge weights, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   int                   maxsols,            /**< maximal number of matchings to return */
+   double                minvalue,           /**< weight that the second and later matchings must exceed */
+   int*                  nsols,              /**< pointer to store the number of returned matchings */
+   double*               solutionvalues,     /**< array to store the weight of each matching */
+   int*                  solutions           /**< array to store the opponents of each matching, at s * nteams */
+);
+
+/** computes a heavy perfect matching on the edges in edgeexists heuristically
+ *
+ * Two starting points are improved by 2-opt swaps: the optimal matching of the last exact solve, if it still only uses
+ * edges of edgeexists, and a greedy matching. The better result is returned. The heuristic may fail to find a perfect
+ * matching even if one exists; in that case found is set to FALSE.
+ */
+void SCIPmatchingHeuristicSRR(
+   SRR_MATCHING*         matching,           /**< matching data */
+   const double*         weights,            /**< edge weights, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used */
+   SCIP_Bool*            found,              /**< pointer to store whether a perfect matching was found */
+   double*               solutionvalue,      /**< pointer to store the weight of the matching */
+   int*                  solution            /**< array to store the opponent of each team */
+);
+
+/** worker threads for solving the matching problems of several rounds in parallel */
+typedef struct SRR_Threadpool SRR_THREADPOOL;
+
+/** creates a thread pool; the calling thread takes part in the work, so nthreads - 1 workers are started */
+SCIP_RETCODE SCIPthreadpoolCreateSRR(
+   SRR_THREADPOOL**      threadpool,         /**< pointer to store the thread pool */
+   int                   nthreads            /**< total number of threads */
+);
+
+/** stops the workers and frees the thread pool */
+void SCIPthreadpoolFreeSRR(
+   SRR_THREADPOOL**      threadpool          /**< pointer to the thread pool */
+);
+
+/** computes up to maxsols maximum weight perfect matchings for each of the nrounds rounds
+ *
+ * Round r uses matchings[r], the weights at r * nedges, the edge bitset at r * nwords and minvalues[r] (see
+ * SCIPmatchingSolveKBestSRR()). It stores the number of matchings in nsols[r], their weights at r * maxsols in
+ * solutionvalues and their opponents at r * maxsols * nteams in solutions. Rounds with skip[r] set are not solved and
+ * get nsols[r] = 0. If threadpool is NULL, the rounds are solved one after another in the calling thread.
+ */
+void SCIPmatchingSolveRoundsSRR(
+   SRR_THREADPOOL*       threadpool,         /**< thread pool, or NULL */
+   SRR_MATCHING**        matchings,          /**< matching data of each round */
+   int                   nrounds,            /**< number of rounds */
+   int                   maxsols,            /**< maximal number of matchings per round */
+   const double*         weights,            /**< edge weights of each round */
+   const SRR_BITWORD*    edgeexists,         /**< bitsets of the edges that may be used on each round */
+   const double*         minvalues,          /**< weight that the second and later matchings of each round must exceed */
+   const SCIP_Bool*      skip,               /**< rounds that need not be solved, or NULL to solve all */
+   int*                  nsols,              /**< array to store the number of matchings of each round */
+   double*               solutionvalues,     /**< array to store the weights of the matchings of each round */
+   int*                  solutions           /**< array to store the opponents in the matchings of each round */
+);
+
+/** runs SCIPmatchingHeuristicSRR() for each of the nrounds rounds
+ *
+ * Round r uses matchings[r], the weights at r * nedges and the edge bitset at r * nwords. It stores whether a matching
+ * was found in found[r], its weight in solutionvalues[r] and its opponents at r * nteams in solutions. If threadpool is
+ * NULL, the rounds are handled one after another in the calling thread.
+ */
+void SCIPmatchingHeuristicRoundsSRR(
+   SRR_THREADPOOL*       threadpool,         /**< thread pool, or NULL */
+   SRR_MATCHING**        matchings,          /**< matching data of each round */
+   int                   nrounds,            /**< number of rounds */
+   const double*         weights,            /**< edge weights of each round */
+   const SRR_BITWORD*    edgeexists,         /**< bitsets of the edges that may be used on each round */
+   SCIP_Bool*            found,              /**< array to store whether a matching was found for each round */
+   double*               solutionvalues,     /**< array to store the weight of the matching of each round */
+   int*                  solutions           /**< array to store the opponents in the matching of each round */
 );
 
 #ifdef __cplusplus
@@ -33,6 +33,7 @@
 
 #include "srrplugins.h"
 #include "probdata_srr.h"
+#include "pricer_srr.h"
 #include "scip/debug.h"
 
 #define COL_MAX_LINELEN 1024
@@ -142,6 +143,193 @@ SCIP_RETCODE fromCommandLine(
    return SCIP_OKAY;
 }
 
+/** builds and solves the LP relaxation of the traditional formulation, with a variable x_{ijr} for each match and round
+ *
+ * The model lives in a separate SCIP instance with the default plugins. The time includes building the model.
+ */
+static
+SCIP_RETCODE solveCompactLP(
+   const char*           name,               /**< problem name */
+   int                   nteams,             /**< number of teams */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            coefs,              /**< objective coefficients */
+   SCIP_Real*            value,              /**< pointer to store the LP value */
+   SCIP_Real*            time                /**< pointer to store the time for building and solving the LP */
+   )
+{
+   SCIP* subscip;
+   SCIP_VAR** vars;
+   SCIP_CONS* cons;
+   char varname[SCIP_MAXSTRLEN];
+   int nedges;
+   int i;
+   int j;
+   int k;
+   int r;
+
+   nedges = nteams * (nteams - 1) / 2;
+
+   SCIP_CALL( SCIPcreate(&subscip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(subscip) );
+   SCIPsetMessagehdlrQuiet(subscip, TRUE);
+
+   SCIP_CALL( SCIPcreateProbBasic(subscip, name) );
+   SCIP_CALL( SCIPallocBufferArray(subscip, &vars, nrounds * nedges) );
+
+   for (r = 0; r < nrounds; ++r)
+   {
+      for (i = 0; i < nteams; ++i)
+      {
+         for (j = i + 1; j < nteams; ++j)
+         {
+            k = SCIPmatchGetIndex(nteams, i, j);
+            (void) SCIPsnprintf(varname, SCIP_MAXSTRLEN, "x_%d_%d_%d", i, j, r);
+            SCIP_CALL( SCIPcreateVarBasic(subscip, &vars[r * nedges + k], varname, 0.0, 1.0,
+               coefs[j + i * nteams + r * nteams * nteams], SCIP_VARTYPE_CONTINUOUS) );
+            SCIP_CALL( SCIPaddVar(subscip, vars[r * nedges + k]) );
+         }
+      }
+   }
+
+   /* every match is played on exactly one round */
+   for (k = 0; k < nedges; ++k)
+   {
+      SCIP_CALL( SCIPcreateConsBasicLinear(subscip, &cons, "match", 0, NULL, NULL, 1.0, 1.0) );
+      for (r = 0; r < nrounds; ++r)
+      {
+         SCIP_CALL( SCIPaddCoefLinear(subscip, cons, vars[r * nedges + k], 1.0) );
+      }
+      SCIP_CALL( SCIPaddCons(subscip, cons) );
+      SCIP_CALL( SCIPreleaseCons(subscip, &cons) );
+   }
+
+   /* every team plays exactly one match on each round */
+   for (r = 0; r < nrounds; ++r)
+   {
+      for (i = 0; i < nteams; ++i)
+      {
+         SCIP_CALL( SCIPcreateConsBasicLinear(subscip, &cons, "team", 0, NULL, NULL, 1.0, 1.0) );
+         for (j = 0; j < nteams; ++j)
+         {
+            if ( i == j )
+               continue;
+            k = SCIPmatchGetIndex(nteams, MIN(i, j), MAX(i, j));
+            SCIP_CALL( SCIPaddCoefLinear(subscip, cons, vars[r * nedges + k], 1.0) );
+         }
+         SCIP_CALL( SCIPaddCons(subscip, cons) );
+         SCIP_CALL( SCIPreleaseCons(subscip, &cons) );
+      }
+   }
+
+   SCIP_CALL( SCIPsolve(subscip) );
+
+   *value = SCIPgetDualbound(subscip);
+   *time = SCIPgetTotalTime(subscip);
+
+   for (k = 0; k < nrounds * nedges; ++k)
+   {
+      SCIP_CALL( SCIPreleaseVar(subscip, &vars[k]) );
+   }
+   SCIPfreeBufferArray(subscip, &vars);
+   SCIP_CALL( SCIPfree(&subscip) );
+
+   return SCIP_OKAY;
+}
+
+/** prints a bound in a column of the root bound table, or "--" if there is none */
+static
+void printBound(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             bound               /**< bound to print */
+   )
+{
+   if ( SCIPisInfinity(scip, REALABS(bound)) )
+      SCIPinfoMessage(scip, NULL, " %16s", "--");
+   else
+      SCIPinfoMessage(scip, NULL, " %16.6f", bound);
+}
+
+/** computes the root bounds of several problems, one line per problem
+ *
+ * For each problem, column generation stops after the root node. Its line holds the LP value of the matching
+ * formulation (the root master LP), the root dual bound (which the rounded Lagrangian bounds may raise above the LP
+ * value), the solving time, and the value and time of the LP relaxation of the traditional formulation.
+ */
+static
+SCIP_RETCODE rootBoundsFromCommandLine(
+   SCIP*                 scip,               /**< SCIP data structure */
+   char**                filenames,          /**< input file names */
+   int                   nfiles              /**< number of input files */
+   )
+{
+   SCIP_CONS** conssmatchingonround;
+   SCIP_CONS** conssmatchisplayed;
+   SCIP_RETCODE retcode;
+   SCIP_Real* coefs;
+   SCIP_Real lpvalue;
+   SCIP_Real compactvalue;
+   SCIP_Real compacttime;
+   int nteams;
+   int nrounds;
+   int f;
+
+   /* Stop after the root node. An incumbent would let the cutoffs of the pricer and of the srrbounds propagator end
+    * column generation early, so neither the heuristics nor the initial schedules of the pricer may give one. Reduced
+    * cost fixing would tighten the LP, and early branching and tailing off would stop it before it is solved.
+    */
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "pricers/matchingpricer/initsolutions", FALSE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "pricers/matchingpricer/redcostfixing", FALSE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "pricers/matchingpricer/earlybranching", FALSE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "pricers/matchingpricer/tailoffiters", 0) );
+
+   SCIPinfoMessage(scip, NULL, "\n%-40s %6s %16s %16s %9s %16s %9s\n", "instance", "teams", "matching LP", "root bound",
+      "time", "traditional LP", "time");
+
+   for (f = 0; f < nfiles; ++f)
+   {
+      retcode = SCIPreadProb(scip, filenames[f], NULL);
+
+      switch( retcode )
+      {
+      case SCIP_NOFILE:
+         SCIPinfoMessage(scip, NULL, "file <%s> not found\n", filenames[f]);
+         continue;
+      case SCIP_PLUGINNOTFOUND:
+         SCIPinfoMessage(scip, NULL, "no reader for input file <%s> available\n", filenames[f]);
+         continue;
+      case SCIP_READERROR:
+         SCIPinfoMessage(scip, NULL, "error reading file <%s>\n", filenames[f]);
+         continue;
+      default:
+         SCIP_CALL( retcode );
+      } /*lint !e788*/
+
+      SCIP_CALL( SCIPsolve(scip) );
+
+      lpvalue = SCIPpricerSRRGetRootLPValue(scip);
+      if ( !SCIPisInfinity(scip, -lpvalue) )
+         lpvalue = SCIPretransformObj(scip, lpvalue);
+
+      SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &nrounds, &coefs, &conssmatchingonround,
+         &conssmatchisplayed) );
+
+      SCIPinfoMessage(scip, NULL, "%-40s %6d", filenames[f], nteams);
+      printBound(scip, lpvalue);
+      printBound(scip, SCIPgetDualboundRoot(scip));
+      SCIPinfoMessage(scip, NULL, " %9.2f", SCIPgetSolvingTime(scip));
+
+      SCIP_CALL( solveCompactLP(filenames[f], nteams, nrounds, coefs, &compactvalue, &compacttime) );
+      printBound(scip, compactvalue);
+      SCIPinfoMessage(scip, NULL, " %9.2f\n", compacttime);
+
+      SCIP_CALL( SCIPfreeProb(scip) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** process the arguments and set up the problem */
 static
 SCIP_RETCODE processArguments(
@@ -155,11 +343,13 @@ SCIP_RETCODE processArguments(
    char* soluname = NULL;
    char* settingsname = NULL;
    char* logname = NULL;
+   char** rootnames = NULL;
    char name_file[COL_MAX_LINELEN];
 
    SCIP_Bool quiet;
    SCIP_Bool paramerror;
    SCIP_Bool interactive;
+   int nrootnames;
    int i;
 
    /********************
@@ -169,6 +359,7 @@ SCIP_RETCODE processArguments(
    quiet = FALSE;
    paramerror = FALSE;
    interactive = (argc == 0);
+   nrootnames = 0;
 
    /*lint -e{850} read the arguments from commandLine */
    for( i = 1; i < argc; ++i )
@@ -211,6 +402,21 @@ SCIP_RETCODE processArguments(
             paramerror = TRUE;
          }
       }
+      else if( strcmp(argv[i], "-r") == 0 )
+      {
+         /* all following arguments up to the next option are problem files */
+         rootnames = &argv[i + 1];
+         while( i + 1 < argc && argv[i + 1][0] != '-' )
+         {
+            ++nrootnames;
+            i++;
+         }
+         if( nrootnames == 0 )
+         {
+            SCIPinfoMessage(scip, NULL, "missing problem filenames after parameter '-r'\n");
+            paramerror = TRUE;
+         }
+      }
       else if( strcmp(argv[i], "-c") == 0 )
       {
          i++;
@@ -282,6 +488,12 @@ SCIP_RETCODE processArguments(
       paramerror = TRUE;
    }
 
+   if( nrootnames > 0 && (interactive || probname != NULL) )
+   {
+      SCIPinfoMessage(scip, NULL, "cannot mix root bound mode '-r' with file mode '-f' or batch mode '-c' and '-b'\n");
+      paramerror = TRUE;
+   }
+
    if( !paramerror )
    {
       /***********************************
@@ -312,6 +524,12 @@ SCIP_RETCODE processArguments(
        * Load settings *
        *****************/
 
+      /* in root bound mode, only the table of bounds is printed unless the settings ask for more */
+      if( nrootnames > 0 )
+      {
+         SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", (int) SCIP_VERBLEVEL_NONE) );
+      }
+
       if( settingsname != NULL )
       {
          SCIP_CALL( readParams(scip, settingsname) );
@@ -330,6 +548,10 @@ SCIP_RETCODE processArguments(
          SCIP_CALL( fromCommandLine(scip, probname, soluname) );
 
       }
+      else if( nrootnames > 0 )
+      {
+         SCIP_CALL( rootBoundsFromCommandLine(scip, rootnames, nrootnames) );
+      }
       else
       {
          SCIPinfoMessage(scip, NULL, "\n");
@@ -338,11 +560,12 @@ SCIP_RETCODE processArguments(
    }
    else
    {
-      SCIPinfoMessage(scip, NULL, "\nsyntax: %s [-l <logfile>] [-q] [-s <settings>] [-f <problem>]\n"
+      SCIPinfoMessage(scip, NULL, "\nsyntax: %s [-l <logfile>] [-q] [-s <settings>] [-f <problem> | -r <problem>...]\n"
          "  -l <logfile>  : copy output into log file\n"
          "  -q            : suppress screen messages\n"
          "  -s <settings> : load parameter settings (.set) file\n"
-         "  -f <problem>  : load and solve problem file\n\n",
+         "  -f <problem>  : load and solve problem file\n"
+         "  -r <problem>...: print the root bounds of the matching and traditional LP relaxations of each problem\n\n",
          argv[0]);
    }
 
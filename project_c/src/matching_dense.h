@@ -0,0 +1,548 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   matching_dense.h
+ * @brief  dense maximum weight perfect matching (blossom algorithm) on subgraphs of the complete graph
+ * @author Jasper van Doornmalen
+ *
+ * An O(n^3) implementation of Edmonds' weighted blossom algorithm on an adjacency matrix. The vertex and blossom duals
+ * are kept in flat arrays, such that the dual update is a branch-free loop over contiguous memory that the compiler
+ * vectorizes.
+ *
+ * The algorithm computes a maximum weight matching. A perfect matching of maximum weight is obtained by adding a
+ * constant to every edge weight that is large enough that each additional edge outweighs any difference in the
+ * original weights.
+ *
+ * The number of vertices is a template parameter, such that the loops have compile time bounds for the common league
+ * sizes; DenseBlossom<0> takes the number of vertices at run time, up to the capacity given on construction.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SRR_MATCHING_DENSE_H__
+#define __SRR_MATCHING_DENSE_H__
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <vector>
+
+/** interface of the dense matching kernels of the different sizes */
+class DenseMatchingBase
+{
+public:
+   virtual ~DenseMatchingBase() {}
+
+   /** computes a maximum weight perfect matching on n vertices
+    *
+    * The weights and the edges that may be used are given as row-major n x n matrices. Returns false if there is no
+    * perfect matching; otherwise, the mate of every vertex is stored in mate.
+    */
+   virtual bool solve(
+      int                n,                  /**< number of vertices, even */
+      const double*      weights,            /**< edge weights */
+      const unsigned char* exists,           /**< whether each edge may be used */
+      int*               mate                /**< array to store the mate of each vertex */
+      ) = 0;
+};
+
+/** dense weighted blossom algorithm for N vertices, or for a number of vertices given at run time if N is 0 */
+template <int N>
+class DenseBlossom : public DenseMatchingBase
+{
+   /** an edge of the original graph; the blossoms keep the original edge that realizes each adjacency */
+   struct Edge
+   {
+      int u;
+      int v;
+      double w;                              /**< shifted weight, zero if the edge does not exist */
+   };
+
+   int capacity;                             /**< maximal number of vertices */
+   int n;                                    /**< number of vertices of the current solve */
+   int nx;                                   /**< number of vertices and blossoms in use */
+   int dim;                                  /**< row length of g, 2 * capacity + 1 */
+   double eps;                               /**< tolerance for tight edges and zero duals */
+   std::vector<Edge> g;                      /**< adjacency matrix of vertices and blossoms, 1-based */
+   std::vector<double> lab;                  /**< duals of the vertices and blossoms */
+   std::vector<double> dir;                  /**< direction of the dual update of each vertex and blossom */
+   std::vector<int> match;
+   std::vector<int> slack;
+   std::vector<int> st;                      /**< outermost blossom containing each vertex */
+   std::vector<int> pa;
+   std::vector<int> S;                       /**< label: -1 free, 0 even (outer), 1 odd (inner) */
+   std::vector<int> vis;
+   std::vector<int> flowerfrom;              /**< flowerfrom[b * (capacity + 1) + x]: sub-blossom of b containing x */
+   std::vector<std::vector<int> > flower;    /**< sub-blossoms of each blossom, in cyclic order */
+   std::deque<int> queue;
+   int visstamp;
+
+   /** number of vertices, a compile time constant if N > 0 */
+   int size() const
+   {
+      return N > 0 ? N : n;
+   }
+
+   Edge& edge(int u, int v)
+   {
+      return g[u * dim + v];
+   }
+
+   double delta(const Edge& e) const
+   {
+      return lab[e.u] + lab[e.v] - g[e.u * dim + e.v].w * 2.0;
+   }
+
+   int& from(int b, int x)
+   {
+      return flowerfrom[b * (capacity + 1) + x];
+   }
+
+   void updateSlack(int u, int x)
+   {
+      if( !slack[x] || delta(edge(u, x)) < delta(edge(slack[x], x)) )
+         slack[x] = u;
+   }
+
+   void setSlack(int x)
+   {
+      const int nv = size();
+      int u;
+
+      slack[x] = 0;
+      for (u = 1; u <= nv; ++u)
+      {
+         if( edge(u, x).w > 0.0 && st[u] != x && S[st[u]] == 0 )
+            updateSlack(u, x);
+      }
+   }
+
+   void queuePush(int x)
+   {
+      size_t i;
+
+      if( x <= size() )
+         queue.push_back(x);
+      else
+      {
+         for (i = 0; i < flower[x].size(); ++i)
+            queuePush(flower[x][i]);
+      }
+   }
+
+   void setSt(int x, int b)
+   {
+      size_t i;
+
+      st[x] = b;
+      if( x > size() )
+      {
+         for (i = 0; i < flower[x].size(); ++i)
+            setSt(flower[x][i], b);
+      }
+   }
+
+   int getPr(int b, int xr)
+   {
+      int pr = (int) (std::find(flower[b].begin(), flower[b].end(), xr) - flower[b].begin());
+
+      if( pr % 2 == 1 )
+      {
+         std::reverse(flower[b].begin() + 1, flower[b].end());
+         return (int) flower[b].size() - pr;
+      }
+      return pr;
+   }
+
+   void setMatch(int u, int v)
+   {
+      int xr;
+      int pr;
+      int i;
+
+      match[u] = edge(u, v).v;
+      if( u > size() )
+      {
+         Edge e = edge(u, v);
+         xr = from(u, e.u);
+         pr = getPr(u, xr);
+         for (i = 0; i < pr; ++i)
+            setMatch(flower[u][i], flower[u][i ^ 1]);
+         setMatch(xr, v);
+         std::rotate(flower[u].begin(), flower[u].begin() + pr, flower[u].end());
+      }
+   }
+
+   void augment(int u, int v)
+   {
+      int xnv;
+
+      for (;;)
+      {
+         xnv = st[match[u]];
+         setMatch(u, v);
+         if( !xnv )
+            return;
+         setMatch(xnv, st[pa[xnv]]);
+         u = st[pa[xnv]];
+         v = xnv;
+      }
+   }
+
+   int getLca(int u, int v)
+   {
+      for (++visstamp; u || v; std::swap(u, v))
+      {
+         if( u == 0 )
+            continue;
+         if( vis[u] == visstamp )
+            return u;
+         vis[u] = visstamp;
+         u = st[match[u]];
+         if( u )
+            u = st[pa[u]];
+      }
+      return 0;
+   }
+
+   void addBlossom(int u, int lca, int v)
+   {
+      const int nv = size();
+      int b = nv + 1;
+      int x;
+      int y;
+      size_t i;
+
+      while( b <= nx && st[b] )
+         ++b;
+      if( b > nx )
+         ++nx;
+
+      lab[b] = 0.0;
+      S[b] = 0;
+      match[b] = match[lca];
+      flower[b].clear();
+      flower[b].push_back(lca);
+      for (x = u; x != lca; x = st[pa[y]])
+      {
+         flower[b].push_back(x);
+         y = st[match[x]];
+         flower[b].push_back(y);
+         queuePush(y);
+      }
+      std::reverse(flower[b].begin() + 1, flower[b].end());
+      for (x = v; x != lca; x = st[pa[y]])
+      {
+         flower[b].push_back(x);
+         y = st[match[x]];
+         flower[b].push_back(y);
+         queuePush(y);
+      }
+      setSt(b, b);
+
+      for (x = 1; x <= nx; ++x)
+      {
+         edge(b, x).w = 0.0;
+         edge(x, b).w = 0.0;
+      }
+      for (x = 1; x <= nv; ++x)
+         from(b, x) = 0;
+
+      for (i = 0; i < flower[b].size(); ++i)
+      {
+         int xs = flower[b][i];
+
+         for (x = 1; x <= nx; ++x)
+         {
+            if( edge(b, x).w == 0.0 || delta(edge(xs, x)) < delta(edge(b, x)) ) /*lint !e777*/
+            {
+               edge(b, x) = edge(xs, x);
+               edge(x, b) = edge(x, xs);
+            }
+         }
+         for (x = 1; x <= nv; ++x)
+         {
+            if( from(xs, x) )
+               from(b, x) = xs;
+         }
+      }
+      setSlack(b);
+   }
+
+   void expandBlossom(int b)
+   {
+      size_t i;
+      int xr;
+      int pr;
+      int k;
+
+      for (i = 0; i < flower[b].size(); ++i)
+         setSt(flower[b][i], flower[b][i]);
+
+      xr = from(b, edge(b, pa[b]).u);
+      pr = getPr(b, xr);
+      for (k = 0; k < pr; k += 2)
+      {
+         int xs = flower[b][k];
+         int xns = flower[b][k + 1];
+
+         pa[xs] = edge(xns, xs).u;
+         S[xs] = 1;
+         S[xns] = 0;
+         slack[xs] = 0;
+         setSlack(xns);
+         queuePush(xns);
+      }
+      S[xr] = 1;
+      pa[xr] = pa[b];
+      for (i = (size_t) pr + 1; i < flower[b].size(); ++i)
+      {
+         int xs = flower[b][i];
+
+         S[xs] = -1;
+         setSlack(xs);
+      }
+      st[b] = 0;
+   }
+
+   bool onFoundEdge(const Edge& e)
+   {
+      int u = st[e.u];
+      int v = st[e.v];
+      int lca;
+      int nu;
+
+      if( S[v] == -1 )
+      {
+         pa[v] = e.u;
+         S[v] = 1;
+         nu = st[match[v]];
+         slack[v] = 0;
+         slack[nu] = 0;
+         S[nu] = 0;
+         queuePush(nu);
+      }
+      else if( S[v] == 0 )
+      {
+         lca = getLca(u, v);
+         if( !lca )
+         {
+            augment(u, v);
+            augment(v, u);
+            return true;
+         }
+         addBlossom(u, lca, v);
+      }
+      return false;
+   }
+
+   /** grows the alternating forest and adjusts the duals until an augmenting path is found */
+   bool augmentOnce()
+   {
+      const int nv = size();
+      bool exhausted;
+      double d;
+      int u;
+      int v;
+      int x;
+      int b;
+
+      std::fill(S.begin() + 1, S.begin() + nx + 1, -1);
+      std::fill(slack.begin() + 1, slack.begin() + nx + 1, 0);
+      queue.clear();
+      for (x = 1; x <= nx; ++x)
+      {
+         if( st[x] == x && !match[x] )
+         {
+            pa[x] = 0;
+            S[x] = 0;
+            queuePush(x);
+         }
+      }
+      if( queue.empty() )
+         return false;
+
+      for (;;)
+      {
+         while( !queue.empty() )
+         {
+            u = queue.front();
+            queue.pop_front();
+            if( S[st[u]] == 1 )
+               continue;
+
+            for (v = 1; v <= nv; ++v)
+            {
+               if( edge(u, v).w > 0.0 && st[u] != st[v] )
+               {
+                  if( delta(edge(u, v)) <= eps )
+                  {
+                     if( onFoundEdge(edge(u, v)) )
+                        return true;
+                  }
+                  else
+                     updateSlack(u, st[v]);
+               }
+            }
+         }
+
+         d = 1e300;
+         for (b = nv + 1; b <= nx; ++b)
+         {
+            if( st[b] == b && S[b] == 1 )
+               d = std::min(d, lab[b] / 2.0);
+         }
+         for (x = 1; x <= nx; ++x)
+         {
+            if( st[x] == x && slack[x] )
+            {
+               if( S[x] == -1 )
+                  d = std::min(d, delta(edge(slack[x], x)));
+               else if( S[x] == 0 )
+                  d = std::min(d, delta(edge(slack[x], x)) / 2.0);
+            }
+         }
+
+         /* The dual update is split into gathering the direction of each vertex and blossom from the labels, and a
+          * branch-free update over the contiguous arrays lab and dir, which the compiler vectorizes. If the dual of an
+          * even vertex reaches zero, no perfect matching exists.
+          */
+         exhausted = false;
+         for (u = 1; u <= nv; ++u)
+         {
+            dir[u] = S[st[u]] == 0 ? -1.0 : (S[st[u]] == 1 ? 1.0 : 0.0);
+            exhausted |= (dir[u] < 0.0) & (lab[u] <= d + eps);
+         }
+         if( exhausted )
+            return false;
+         for (b = nv + 1; b <= nx; ++b)
+            dir[b] = st[b] != b ? 0.0 : (S[b] == 0 ? 2.0 : (S[b] == 1 ? -2.0 : 0.0));
+
+         for (x = 1; x <= nx; ++x)
+            lab[x] += dir[x] * d;
+
+         queue.clear();
+         for (x = 1; x <= nx; ++x)
+         {
+            if( st[x] == x && slack[x] && st[slack[x]] != x && delta(edge(slack[x], x)) <= eps )
+            {
+               if( onFoundEdge(edge(slack[x], x)) )
+                  return true;
+            }
+         }
+         for (b = nv + 1; b <= nx; ++b)
+         {
+            if( st[b] == b && S[b] == 1 && lab[b] <= eps )
+               expandBlossom(b);
+         }
+      }
+   }
+
+public:
+   DenseBlossom(int maxn) :
+      capacity(N > 0 ? N : maxn),
+      n(N > 0 ? N : maxn),
+      nx(0),
+      dim(2 * capacity + 1),
+      eps(0.0),
+      g((size_t) dim * dim),
+      lab(dim),
+      dir(dim),
+      match(dim),
+      slack(dim),
+      st(dim),
+      pa(dim),
+      S(dim),
+      vis(dim),
+      flowerfrom((size_t) dim * (capacity + 1)),
+      flower(dim),
+      visstamp(0)
+   {
+   }
+
+   bool solve(int nvertices, const double* weights, const unsigned char* exists, int* mate)
+   {
+      double minweight;
+      double maxweight;
+      double shift;
+      double wmax;
+      int nv;
+      int u;
+      int v;
+
+      assert( N == 0 || nvertices == N );
+      assert( nvertices <= capacity );
+      n = nvertices;
+      nv = size();
+
+      minweight = 0.0;
+      maxweight = 0.0;
+      for (u = 0; u < nv * nv; ++u)
+      {
+         if( exists[u] )
+         {
+            minweight = std::min(minweight, weights[u]);
+            maxweight = std::max(maxweight, weights[u]);
+         }
+      }
+
+      /* with this shift, a matching with more edges always has a larger shifted weight */
+      shift = (nv / 2) * (maxweight - minweight) + 1.0;
+      eps = 1e-9 * std::max(1.0, shift + maxweight - minweight);
+
+      wmax = 0.0;
+      for (u = 1; u <= nv; ++u)
+      {
+         for (v = 1; v <= nv; ++v)
+         {
+            Edge& e = edge(u, v);
+
+            e.u = u;
+            e.v = v;
+            e.w = (u != v && exists[(u - 1) * nv + (v - 1)]) ? weights[(u - 1) * nv + (v - 1)] - minweight + shift : 0.0;
+            wmax = std::max(wmax, e.w);
+            from(u, v) = (u == v ? u : 0);
+         }
+      }
+
+      nx = nv;
+      std::fill(match.begin(), match.end(), 0);
+      std::fill(vis.begin(), vis.end(), 0);
+      visstamp = 0;
+      std::fill(st.begin(), st.end(), 0);
+      for (u = 0; u <= nv; ++u)
+      {
+         st[u] = u;
+         flower[u].clear();
+      }
+      for (u = 1; u <= nv; ++u)
+         lab[u] = wmax;
+
+      while( augmentOnce() )
+      {
+      }
+
+      for (u = 1; u <= nv; ++u)
+      {
+         if( !match[u] )
+            return false;
+         mate[u - 1] = match[u] - 1;
+      }
+
+      return true;
+   }
+};
+
+#endif
@@ -27,12 +27,14 @@
 
 #include "scip/scipdefplugins.h"
 #include "scip/scip.h"
-#include "scip/struct_tree.h"
-#include "scip/tree.h"
 #include "pricer_srr.h"
 #include "probdata_srr.h"
 #include "lemon_wrapper.h"
 #include "cons_matchonround.h"
+#include "bitset_srr.h"
+#include "vardata_srr.h"
+#include "lagrangian_srr.h"
+#include "sepa_subsetrow.h"
 
 /**@name Pricer properties
  *
@@ -44,9 +46,38 @@
 #define PRICER_PRIORITY        0
 #define PRICER_DELAY           TRUE          /* only call pricer if all problem variables have non-negative reduced costs */
 
+#define DEFAULT_NTHREADS       1             /**< number of threads used for solving the matching problems */
+#define DEFAULT_MAXCOLSROUND   1             /**< maximal number of columns per round and pricing call */
+#define DEFAULT_ENGINE         'a'           /**< matching engine: 'l'emon, 'd'ense blossom, 'a'uto (subset DP if small) */
+#define DEFAULT_HEURISTIC      TRUE          /**< should heuristic matchings be tried before the exact solve? */
+#define DEFAULT_STABILIZATION  'n'           /**< dual stabilization: 'n'one, 'w'entges smoothing, 'i'n-out */
+#define DEFAULT_ALPHA          0.8           /**< smoothing factor of Wentges smoothing, initial factor of in-out */
+#define DEFAULT_EARLYBRANCHING TRUE          /**< stop pricing if the rounded Lagrangian bound meets the rounded LP value? */
+#define DEFAULT_TAILOFFITERS   0             /**< number of calls with small LP progress after which to branch (0: off) */
+#define DEFAULT_TAILOFFGAP     1e-3          /**< relative LP progress per call below which a call counts as tailing off */
+#define DEFAULT_POOLSIZE       10000         /**< maximal number of deleted matchings kept in the column pool (0: off) */
+#define MAX_POOLSIZE           1000000       /**< largest allowed value of the poolsize parameter */
+#define DEFAULT_LAGRANGIANITERS 0            /**< number of subgradient iterations for the first root bound (0: off) */
+#define DEFAULT_PHASEONE       'f'           /**< how to make node LPs feasible: 'f'arkas pricing, 'b'ig-M artificial columns */
+#define DEFAULT_INITFACTORIZATIONS 5       /**< number of 1-factorizations whose factors are added as initial columns */
+#define DEFAULT_INITSOLUTIONS  TRUE          /**< should the schedules of the initial 1-factorizations be tried as solutions? */
+#define DEFAULT_RANDSEED       42            /**< seed for the relabelings of the initial 1-factorizations */
+#define DEFAULT_SPARSETOPK     0             /**< number of candidate edges per team of the sparse tier (0: off) */
+#define DEFAULT_PARTIALCOLS    0             /**< number of columns after which an exact pass stops (0: price all rounds) */
+#define DEFAULT_SKIPROUNDS     TRUE          /**< skip the exact solve of rounds whose bound shows they cannot price out? */
+
+#define DEFAULT_REDCOSTFIXING  TRUE          /**< should edges be removed from rounds by reduced cost fixing? */
+#define DEFAULT_SUBSETROWMAXSOLS 1024        /**< maximal number of matchings enumerated per round with subset-row cuts */
+#define SUBSETROW_FIRSTSOLS    16            /**< number of matchings enumerated per round at first with subset-row cuts */
+
 #define EVENTHDLR_NAME         "srrpricereventvardeleted"
 #define EVENTHDLR_DESC         "event handler for variable deleted event"
 
+#define TABLE_NAME             "matchingpricer"
+#define TABLE_DESC             "matching pricer statistics"
+#define TABLE_POSITION         10500         /**< the position of the statistics table, after the pricer table */
+#define TABLE_EARLIEST_STAGE   SCIP_STAGE_SOLVING /**< output of the statistics table is only printed from this stage onwards */
+
 
 /**@} */
 
@@ -55,17 +86,144 @@
  * Data structures
  */
 
+/** variable pricer data */
+struct SCIP_PricerData
+{
+   int                   nrounds;            /**< number of rounds, i.e., number of matching data structures */
+   SRR_MATCHING**        matchings;          /**< persistent matching data for each round */
+   SRR_THREADPOOL*       threadpool;         /**< worker threads solving the rounds in parallel, or NULL */
+   int                   nthreads;           /**< number of threads used for solving the matching problems */
+   int                   maxcolsround;       /**< maximal number of columns per round and pricing call (k-best) */
+   char                  engine;             /**< matching engine: 'l'emon, 'd'ense blossom, 'a'uto (subset DP if small) */
+   SCIP_Bool             heuristic;          /**< should heuristic matchings be tried before the exact solve? */
+   char                  stabilization;      /**< dual stabilization: 'n'one, 'w'entges smoothing, 'i'n-out */
+   SCIP_Real             alpha;              /**< smoothing factor of Wentges smoothing, initial factor of in-out */
+   SCIP_Real             stabalpha;          /**< current smoothing factor of in-out stabilization */
+   SCIP_Real*            stabcenter;         /**< stability center: round duals followed by match duals */
+   SCIP_Real             stabcenterbound;    /**< Lagrangian bound of the stability center, or -infinity if none */
+   SCIP_Longint          curnode;            /**< number of the node of the last pricing call */
+   SCIP_Real             nodebound;          /**< best Lagrangian bound at the current node, or -infinity if none */
+   SCIP_Real             lastlpobj;          /**< LP value at the last reduced cost pricing call at the current node */
+   int                   ntailoff;           /**< number of consecutive calls at the current node with small LP progress */
+   SCIP_Bool             earlybranching;     /**< stop pricing if the rounded Lagrangian bound meets the rounded LP value? */
+   int                   tailoffiters;       /**< number of calls with small LP progress after which to branch (0: off) */
+   SCIP_Real             tailoffgap;         /**< relative LP progress per call below which a call counts as tailing off */
+   SCIP_Longint          nredcostcalls;      /**< number of reduced cost pricing calls */
+   SCIP_Longint          nfarkascalls;       /**< number of Farkas pricing calls */
+   SCIP_Longint          nexactpasses;       /**< number of exact solves of all rounds */
+   SCIP_Longint          nheurpasses;        /**< number of calls in which the heuristics found improving columns */
+   SCIP_Longint          ncolsexact;         /**< number of columns found by the exact solves */
+   SCIP_Longint          ncolsheur;          /**< number of columns found by the heuristics */
+   SCIP_Longint          nmispricings;       /**< number of stabilized separation points without improving column */
+   SCIP_Longint          ncenterupdates;     /**< number of updates of the stability center */
+   SCIP_Longint          ncutoffs;           /**< number of nodes cut off by the Lagrangian bound */
+   SCIP_Longint          nearlybranchings;   /**< number of nodes branched on because the rounded bounds met */
+   SCIP_Longint          ntailoffbranchings; /**< number of nodes branched on because of tailing off */
+   int                   nteams;             /**< number of teams */
+   int*                  edgeteams;          /**< the teams of edge k at 2k and 2k + 1 */
+   SCIP_HASHTABLE**      colindex;           /**< columns of each round, indexed by the edge bitset of their matching */
+   SCIP_Longint          nduplicates;        /**< number of matchings rejected because their column exists */
+   int                   poolsize;           /**< maximal number of deleted matchings kept in the column pool (0: off) */
+   int                   poolcap;            /**< maximal number of matchings kept per round */
+   int*                  pool;               /**< edges of the pooled matchings, poolcap * nteams / 2 per round */
+   int*                  npool;              /**< number of pooled matchings of each round */
+   int*                  poolnext;           /**< position in a full pool of a round that is overwritten next */
+   SCIP_Longint          npoolinserts;       /**< number of deleted columns stored in the pool */
+   SCIP_Longint          npooloverwrites;    /**< number of pooled matchings overwritten because the pool was full */
+   SCIP_Longint          npoolhits;          /**< number of columns re-added from the pool */
+   SCIP_Longint          npoolmisses;        /**< number of pricing calls in which the pool gave no column */
+   int                   lagrangianiters;    /**< number of subgradient iterations for the first root bound (0: off) */
+   SCIP_Bool             lagrangiandone;     /**< did the subgradient method run? */
+   SCIP_Real             lagrangianrootbound; /**< bound of the subgradient method */
+   SCIP_Real             rootlpobj;          /**< last LP value at the root that pricing proved optimal, or -infinity */
+   SCIP_Longint          nlagrangianiters;   /**< number of subgradient iterations */
+   char                  phaseone;           /**< how to make node LPs feasible: 'f'arkas pricing, 'b'ig-M artificial columns */
+   SCIP_VAR**            artificials;        /**< artificial columns of the round- and match-constraints, or NULL */
+   SCIP_Real             bigm;               /**< current penalty of the artificial columns */
+   SCIP_Real             artbound;           /**< largest cost of a schedule, to prove infeasibility with big-M */
+   SCIP_Longint          nbigmincreases;     /**< number of times the penalty of the artificial columns was raised */
+   SCIP_Longint          nartcutoffs;        /**< number of nodes proven infeasible with the artificial columns */
+   int                   initfactorizations; /**< number of 1-factorizations whose factors are added as initial columns */
+   SCIP_Bool             initsolutions;      /**< should the schedules of the initial 1-factorizations be tried as solutions? */
+   SCIP_Bool             initcolsadded;      /**< were the initial columns added? */
+   SCIP_Longint          ncolsinit;          /**< number of initial columns */
+   int                   sparsetopk;         /**< number of candidate edges per team of the sparse tier (0: off) */
+   SCIP_Longint          nsparsepasses;      /**< number of passes on the sparse candidate edges */
+   SCIP_Longint          ncolssparse;        /**< number of columns found on the sparse candidate edges */
+   int                   partialcols;        /**< number of columns after which an exact pass stops (0: price all rounds) */
+   SCIP_Real*            roundscores;        /**< best reduced value of the last exact solve of each round, for ordering */
+   SCIP_Longint          npartialstops;      /**< number of exact passes stopped before all rounds were solved */
+   SCIP_Bool             skiprounds;         /**< skip the exact solve of rounds whose bound shows they cannot price out? */
+   SCIP_Real*            lastweights;        /**< edge weights of the last exact solve of each round, r * nedges */
+   SRR_BITWORD*          lastedges;          /**< usable edges of the last exact solve of each round, r * nwords */
+   SCIP_Real*            lastoptimum;        /**< optimal matching weight of the last exact solve of each round */
+   SCIP_Bool*            lastvalid;          /**< is the last exact solve of each round usable for a bound? */
+   SCIP_Bool             lastfarkas;         /**< were the last exact solves for Farkas duals? */
+   SCIP_Longint          nskippedrounds;     /**< number of round solves skipped because of their bound */
+
+   SCIP_Bool             redcostfixing;      /**< should edges be removed from rounds by reduced cost fixing? */
+   SRR_BITWORD*          globaledges;        /**< edges of each round not removed by reduced cost fixing, r * nwords */
+   SCIP_Real*            fixmu;              /**< match duals of the best root Lagrangian bound, for reduced cost fixing */
+   SCIP_Real             fixmubound;         /**< Lagrangian bound of fixmu, or -infinity if none */
+   SCIP_Real             fixcutoff;          /**< cutoff bound of the last reduced cost fixing */
+   SCIP_Bool             fixpending;         /**< did fixmu change since the last reduced cost fixing? */
+   SCIP_Longint          nfixings;           /**< number of reduced cost fixing runs */
+   SCIP_Longint          nfixsolves;         /**< number of matching solves for reduced cost fixing */
+   SCIP_Longint          nfixededges;        /**< number of edges removed from rounds by reduced cost fixing */
+   SCIP_Longint          nfixedcols;         /**< number of columns fixed to zero because they use a removed edge */
+   int                   subsetrowmaxsols;   /**< maximal number of matchings enumerated per round with subset-row cuts */
+   SCIP_Longint          nsubsetrowcalls;    /**< number of pricing calls in which subset-row cuts had non-zero duals */
+   SCIP_Longint          nsubsetrowsols;     /**< number of matchings enumerated because of subset-row cuts */
+   SCIP_Longint          nsubsetrowstops;    /**< number of calls that stopped with rounds whose enumeration was cut short */
+};
+
 
 /*
  * Event handler
  */
 
+/** stores the matching of a deleted column in the pool of its round
+ *
+ * If the pool of the round is full, the pooled matchings are overwritten in turn, such that the oldest go first.
+ */
+static
+void poolInsert(
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   r,                  /**< round of the matching */
+   const int*            edges               /**< the nteams / 2 edges of the matching */
+   )
+{
+   int nmatches;
+   int pos;
+
+   nmatches = pricerdata->nteams / 2;
+
+   if ( pricerdata->npool[r] < pricerdata->poolcap )
+      pos = pricerdata->npool[r]++;
+   else
+   {
+      pos = pricerdata->poolnext[r];
+      pricerdata->poolnext[r] = (pos + 1) % pricerdata->poolcap;
+      ++pricerdata->npooloverwrites;
+   }
+
+   BMScopyMemoryArray(&pricerdata->pool[(r * pricerdata->poolcap + pos) * nmatches], edges, nmatches);
+   ++pricerdata->npoolinserts;
+}
+
 /** execution method of event handler */
 static
 SCIP_DECL_EVENTEXEC(eventExecVardeleted)
 {
+   SCIP_PRICERDATA* pricerdata;
+   SCIP_VARDATA* vardata;
    SCIP_VAR* var;
-   int idx;
+   const SRR_BITWORD* varedges;
+   int* edges;
+   int nedges;
+   int nmatches;
+   int k;
+   int r;
 
    assert(SCIPeventGetType(event) == SCIP_EVENTTYPE_VARDELETED);
    var = SCIPeventGetVar(event);
@@ -73,62 +231,1291 @@ SCIP_DECL_EVENTEXEC(eventExecVardeleted)
    assert( var != NULL );
    assert( SCIPvarIsDeletable(var) );
 
-   /* get index of variable in stablesets array */
-   idx = (int)(size_t) SCIPvarGetData(var);
+   pricerdata = SCIPpricerGetData(SCIPfindPricer(scip, PRICER_NAME));
+   assert( pricerdata != NULL );
 
-   SCIPdebugMsg(scip, "remove variable %s [%d]\n", SCIPvarGetName(var), idx);
+   vardata = SCIPvarGetData(var);
+   r = SCIPvardataGetRoundSRR(vardata);
+   varedges = SCIPvardataGetEdgesSRR(vardata);
+
+   SCIPdebugMsg(scip, "remove variable %s [round %d]\n", SCIPvarGetName(var), r);
+
+   /* the index may hold a later column of the same matching instead, see addMatchingVar() */
+   if ( SCIPhashtableRetrieve(pricerdata->colindex[r], (void*) varedges) == (void*) var )
+   {
+      SCIP_CALL( SCIPhashtableRemove(pricerdata->colindex[r], (void*) var) );
+   }
 
-   /* remove variable from stablesets array and release it */
+   /* keep the matching for re-pricing */
+   if ( pricerdata->poolcap > 0 )
+   {
+      nmatches = pricerdata->nteams / 2;
+      nedges = nmatches * (pricerdata->nteams - 1);
+      SCIP_CALL( SCIPallocBufferArray(scip, &edges, nmatches) );
+      nmatches = 0;
+      for (k = 0; k < nedges; ++k)
+      {
+         if ( SRRbitsetIsSet(varedges, k) )
+            edges[nmatches++] = k;
+      }
+      assert( nmatches == pricerdata->nteams / 2 );
+      poolInsert(pricerdata, r, edges);
+      SCIPfreeBufferArray(scip, &edges);
+   }
+
+   /* release the variable */
    SCIP_CALL( SCIPreleaseVar(scip, &var) );
 
    return SCIP_OKAY;
 }/*lint !e715*/
 
+/** gets the key of a column in the column index of its round: the edge bitset of its matching */
+static
+SCIP_DECL_HASHGETKEY(hashGetKeyColumn)
+{  /*lint --e{715}*/
+   return (void*) SCIPvardataGetEdgesSRR(SCIPvarGetData((SCIP_VAR*) elem));
+}
+
+/** returns whether two edge bitsets are equal */
+static
+SCIP_DECL_HASHKEYEQ(hashKeyEqColumn)
+{  /*lint --e{715}*/
+   SCIP_PRICERDATA* pricerdata = (SCIP_PRICERDATA*) userptr;
+   int nwords;
+
+   nwords = SRRbitsetNWords((pricerdata->nteams / 2) * (pricerdata->nteams - 1));
+
+   return memcmp(key1, key2, nwords * sizeof(SRR_BITWORD)) == 0 ? TRUE : FALSE;
+}
+
+/** returns the hash value of an edge bitset */
+static
+SCIP_DECL_HASHKEYVAL(hashKeyValColumn)
+{  /*lint --e{715}*/
+   SCIP_PRICERDATA* pricerdata = (SCIP_PRICERDATA*) userptr;
+   const SRR_BITWORD* edges = (const SRR_BITWORD*) key;
+   uint64_t hash;
+   int nwords;
+   int w;
+
+   nwords = SRRbitsetNWords((pricerdata->nteams / 2) * (pricerdata->nteams - 1));
+
+   hash = 0;
+   for (w = 0; w < nwords; ++w)
+      hash = (hash ^ edges[w]) * 0x9e3779b97f4a7c15ULL;
+
+   return hash;
+}
+
 
 /**@name Local methods
  *
- * @{
+ * @{
+ */
+
+/** creates the variable of the matching `solution` on round r, and adds it to the master problem
+ *
+ * The matching is not added if a column of the same matching on round r exists that is not fixed to zero at the node.
+ */
+static
+SCIP_RETCODE addMatchingVar(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   r,                  /**< round of the matching */
+   int*                  solution,           /**< opponent of each team in the matching */
+   SCIP_Bool*            added,              /**< pointer to store whether the column was added */
+   SCIP_VAR**            column              /**< pointer to store the column of the matching, or NULL */
+)
+{
+   int i;
+   int j;
+   int k;
+   int nteams;
+   int nrounds;
+   SCIP_Real* coefs;
+   SCIP_CONS** conssmatchingonround;
+   SCIP_CONS** conssmatchisplayed;
+   SCIP_CONS* cons;
+   SCIP_Real matchingvalue;
+   SCIP_VARDATA* vardata;
+   SCIP_VAR* var;
+   SCIP_VAR* oldvar;
+   SRR_BITWORD* edges;
+   SCIP_ROW** cutrows;
+   int* cutedges;
+   int ncuts;
+   int c;
+
+   SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &nrounds, &coefs, &conssmatchingonround,
+      &conssmatchisplayed) );
+
+   /* reject duplicates in O(1) through the column index of the round */
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &edges, SRRbitsetNWords((nteams / 2) * (nteams - 1))) );
+   for (i = 0; i < nteams; ++i)
+   {
+      if ( i < solution[i] )
+         SRRbitsetSet(edges, SCIPmatchGetIndex(nteams, i, solution[i]));
+   }
+   oldvar = (SCIP_VAR*) SCIPhashtableRetrieve(pricerdata->colindex[r], (void*) edges);
+   SCIPfreeBufferArray(scip, &edges);
+
+   if ( oldvar != NULL && SCIPisGT(scip, SCIPvarGetUbLocal(oldvar), 0.0) )
+   {
+      ++pricerdata->nduplicates;
+      *added = FALSE;
+      if ( column != NULL )
+         *column = oldvar;
+      return SCIP_OKAY;
+   }
+
+   matchingvalue = 0.0;
+   for (i = 0; i < nteams; ++i)
+   {
+      j = solution[i];
+      assert( i == solution[j] );
+      if ( i < j )
+         matchingvalue += coefs[j + i * nteams + r * nteams * nteams];
+   }
+
+   /* create and add variable */
+   SCIP_CALL( SCIPvardataCreateSRR(scip, &vardata, nteams, r, solution) );
+   SCIP_CALL( SCIPcreateVarSRR(scip, &var, NULL, matchingvalue, TRUE, TRUE, vardata) );
+   SCIPvarMarkDeletable(var);
+   SCIP_CALL( SCIPaddPricedVar(scip, var, 1.0) );
+   SCIPdebugMsg(scip, "added variable %i\n", SCIPgetNVars(scip));
+   *added = TRUE;
+   if ( column != NULL )
+      *column = var;
+
+   /* a column of the same matching that is fixed to zero here is replaced in the index */
+   if ( oldvar != NULL )
+   {
+      SCIP_CALL( SCIPhashtableRemove(pricerdata->colindex[r], (void*) oldvar) );
+   }
+   SCIP_CALL( SCIPhashtableInsert(pricerdata->colindex[r], (void*) var) );
+
+   /* catch variable deleted event on the variable, to pool its matching and release it */
+   SCIP_CALL( SCIPcatchVarEvent(scip, var, SCIP_EVENTTYPE_VARDELETED, SCIPfindEventhdlr(scip, EVENTHDLR_NAME),
+      NULL, NULL) );
+
+   /* set coefficient in round-constraint */
+   SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchingonround[r], &cons) );
+   SCIP_CALL( SCIPaddCoefLinear(scip, cons, var, 1.0) );
+
+   /* set coefficient in matching constraint */
+   for (i = 0; i < nteams; ++i)
+   {
+      j = solution[i];
+      if ( i < j )
+      {
+         k = SCIPmatchGetIndex(nteams, i, j);
+         SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchisplayed[k], &cons) );
+         SCIP_CALL( SCIPaddCoefLinear(scip, cons, var, 1.0) );
+      }
+   }
+
+   /* set coefficient in the subset-row cuts that contain two of its matches */
+   SCIPgetSubsetRowCutsSRR(scip, &ncuts, &cutrows, &cutedges);
+   for (c = 0; c < ncuts; ++c)
+   {
+      if ( SCIPisInSubsetRowSRR(&cutedges[3 * c], SCIPvardataGetEdgesSRR(vardata)) )
+      {
+         SCIP_CALL( SCIPaddVarToRow(scip, cutrows[c], var, 1.0) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** computes the weight of a matching on round r for the given match duals, plus the round dual
+ *
+ * This is the negated reduced cost of the matching's column, or its Farkas value if farkas is TRUE.
+ */
+static
+SCIP_Real getMatchingRedvalue(
+   int                   nteams,             /**< number of teams */
+   int                   r,                  /**< round of the matching */
+   SCIP_Real*            coefs,              /**< cost coefficients of the problem */
+   SCIP_Real             roundpi,            /**< dual of the round-constraint of round r */
+   SCIP_Real*            matchpi,            /**< duals of the match constraints */
+   SCIP_Bool             farkas,             /**< are the duals Farkas multipliers? */
+   int*                  solution            /**< opponent of each team in the matching */
+)
+{
+   SCIP_Real value;
+   int i;
+   int j;
+
+   value = roundpi;
+   for (i = 0; i < nteams; ++i)
+   {
+      j = solution[i];
+      if ( i < j )
+      {
+         value += matchpi[SCIPmatchGetIndex(nteams, i, j)];
+         if ( !farkas )
+            value -= coefs[j + i * nteams + r * nteams * nteams];
+      }
+   }
+
+   return value;
+}
+
+/** computes the edge weights of every round for the given match duals
+ *
+ * The weights of round r are stored at r * nedges, in the order of SCIPmatchGetIndex().
+ */
+static
+void computeWeights(
+   int                   nteams,             /**< number of teams */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            coefs,              /**< cost coefficients of the problem */
+   SCIP_Real*            matchpi,            /**< duals of the match constraints */
+   SCIP_Bool             farkas,             /**< are the duals Farkas multipliers? */
+   SCIP_Real*            weights             /**< array to store the weights */
+)
+{
+   int nedges;
+   int i;
+   int j;
+   int k;
+   int r;
+
+   nedges = (nteams / 2) * (nteams - 1);
+   for (r = 0; r < nrounds; ++r)
+   {
+      k = -1;
+      for (i = 0; i < nteams; ++i)
+      {
+         for (j = i + 1; j < nteams; ++j)
+         {
+            ++k;
+            /* edgeexists and weights arrays follow the natural unordered edge sorting,
+            * that (i,j) < (i',j') if i < i', or i = i' and j < j'.
+            */
+            weights[r * nedges + k] = farkas?
+               matchpi[k]:
+               matchpi[k] - coefs[j + i * nteams + r * nteams * nteams];
+            assert( coefs[i + j * nteams + r * nteams * nteams] == coefs[j + i * nteams + r * nteams * nteams] );
+         }
+      }
+   }
+}
+
+/** re-adds the pooled matchings that use only allowed edges and have negative reduced cost
+ *
+ * At most maxcolsround matchings are re-added per round. They are removed from the pool, as they are columns again.
+ */
+static
+SCIP_RETCODE pricePool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            roundpi,            /**< duals of the round-constraints */
+   SCIP_Real*            weights,            /**< edge weights of every round, see computeWeights() */
+   SRR_BITWORD*          edgeexists,         /**< bitsets of the edges that may be used on each round */
+   int*                  solution,           /**< buffer for the opponents of a matching */
+   int*                  ncolsadded          /**< pointer to increase by the number of re-added columns */
+)
+{
+   SCIP_Real value;
+   SCIP_Real* roundweights;
+   int* edges;
+   int nmatches;
+   int nedges;
+   int nwords;
+   SCIP_Bool added;
+   int nadded;
+   int naddedround;
+   int nteams;
+   int p;
+   int e;
+   int r;
+
+   nteams = pricerdata->nteams;
+   nmatches = nteams / 2;
+   nedges = nmatches * (nteams - 1);
+   nwords = SRRbitsetNWords(nedges);
+   nadded = 0;
+
+   for (r = 0; r < nrounds; ++r)
+   {
+      roundweights = &weights[r * nedges];
+      naddedround = 0;
+      for (p = pricerdata->npool[r] - 1; p >= 0 && naddedround < pricerdata->maxcolsround; --p)
+      {
+         edges = &pricerdata->pool[(r * pricerdata->poolcap + p) * nmatches];
+
+         value = roundpi[r];
+         for (e = 0; e < nmatches; ++e)
+            value += roundweights[edges[e]];
+         if ( !SCIPisGT(scip, value, 0.0) )
+            continue;
+
+         /* the matching must respect the branching decisions of the node */
+         for (e = 0; e < nmatches; ++e)
+         {
+            if ( !SRRbitsetIsSet(&edgeexists[r * nwords], edges[e]) )
+               break;
+         }
+         if ( e < nmatches )
+            continue;
+
+         for (e = 0; e < nmatches; ++e)
+         {
+            solution[pricerdata->edgeteams[2 * edges[e]]] = pricerdata->edgeteams[2 * edges[e] + 1];
+            solution[pricerdata->edgeteams[2 * edges[e] + 1]] = pricerdata->edgeteams[2 * edges[e]];
+         }
+         SCIP_CALL( addMatchingVar(scip, pricerdata, r, solution, &added, NULL) );
+         if ( added )
+         {
+            ++naddedround;
+            ++nadded;
+         }
+
+         /* remove the matching from the pool, it is a column again */
+         --pricerdata->npool[r];
+         BMScopyMemoryArray(edges, &pricerdata->pool[(r * pricerdata->poolcap + pricerdata->npool[r]) * nmatches],
+            nmatches);
+      }
+   }
+
+   if ( nadded > 0 )
+      pricerdata->npoolhits += nadded;
+   else
+      ++pricerdata->npoolmisses;
+   *ncolsadded += nadded;
+
+   return SCIP_OKAY;
+}
+
+/** adapts the smoothing factor of in-out stabilization to the subgradient at the separation point
+ *
+ * The Lagrangian subgradient for match k is 1 minus the number of rounds whose optimal matching plays k; the
+ * subgradients of the round-constraints are zero. If the subgradient points away from the center towards the LP
+ * duals, the center is too heavily weighted and alpha is decreased; otherwise it is increased.
+ */
+static
+void updateInOutAlpha(
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   nteams,             /**< number of teams */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            matchpi,            /**< LP duals of the match constraints */
+   int*                  solutions,          /**< solutions of the exact pass, the optimal one at r * maxsols * nteams */
+   int                   maxsols             /**< number of solutions per round in solutions */
+)
+{
+   SCIP_Real* center;
+   SCIP_Real prod;
+   int nedges;
+   int i;
+   int j;
+   int k;
+   int r;
+
+   nedges = (nteams / 2) * (nteams - 1);
+   center = &pricerdata->stabcenter[nrounds];
+
+   prod = 0.0;
+   for (k = 0; k < nedges; ++k)
+      prod += matchpi[k] - center[k];
+   for (r = 0; r < nrounds; ++r)
+   {
+      for (i = 0; i < nteams; ++i)
+      {
+         j = solutions[r * maxsols * nteams + i];
+         if ( i < j )
+         {
+            k = SCIPmatchGetIndex(nteams, i, j);
+            prod -= matchpi[k] - center[k];
+         }
+      }
+   }
+
+   if ( prod > 0.0 )
+      pricerdata->stabalpha = MAX(0.0, pricerdata->stabalpha - 0.1);
+   else
+      pricerdata->stabalpha = MIN(0.9, pricerdata->stabalpha + 0.1 * (1.0 - pricerdata->stabalpha));
+}
+
+/** adds the matchings of round r that are improving both at the separation point and for the LP duals */
+static
+SCIP_RETCODE addRoundColumns(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   r,                  /**< round */
+   SCIP_Real*            coefs,              /**< cost coefficients of the problem */
+   SCIP_Real*            roundpi,            /**< LP duals of the round-constraints */
+   SCIP_Real*            matchpi,            /**< LP duals of the match constraints */
+   SCIP_Real*            sepapi,             /**< duals of the separation point, round-constraints first */
+   SCIP_Bool             farkas,             /**< are the duals Farkas multipliers? */
+   int                   maxsols,            /**< number of solutions per round in the solution arrays */
+   int*                  nsols,              /**< number of matchings of each round */
+   SCIP_Real*            solutionvalues,     /**< weights of the matchings of each round, sorted */
+   int*                  solutions,          /**< opponents in the matchings of each round */
+   int*                  ncolsadded          /**< pointer to increase by the number of added columns */
+)
+{
+   SCIP_Bool added;
+   int nteams;
+   int s;
+
+   nteams = pricerdata->nteams;
+
+   /* if no perfect matching respects the branching decisions on this round, nsols[r] is zero */
+   for (s = 0; s < nsols[r]; ++s)
+   {
+      /* the matchings of a round are sorted by weight for the separation point */
+      if ( !SCIPisGT(scip, sepapi[r] + solutionvalues[r * maxsols + s], 0.0) )
+         break;
+
+      /* If this matching is improving for the LP duals, add it! */
+      if ( !SCIPisGT(scip, getMatchingRedvalue(nteams, r, coefs, roundpi[r], matchpi, farkas,
+               &solutions[(r * maxsols + s) * nteams]), 0.0) )
+         continue;
+
+      SCIP_CALL( addMatchingVar(scip, pricerdata, r, &solutions[(r * maxsols + s) * nteams], &added, NULL) );
+      if ( added )
+         ++(*ncolsadded);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** computes the sparse candidate edges of every round
+ *
+ * Since every edge of a matching weighs at most the heaviest usable edge at either of its teams, a matching that uses
+ * edge {i, j} weighs at most w_ij + 1/2 sum_{t != i, j} maxw_t. Edges for which this bound is not improving are left
+ * out. Of the remaining edges, each team keeps its topk heaviest; an edge is a candidate if one of its teams keeps it.
+ */
+static
+SCIP_RETCODE computeSparseEdges(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nteams,             /**< number of teams */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            sepapi,             /**< duals of the separation point, round-constraints first */
+   SCIP_Real*            weights,            /**< edge weights of every round, see computeWeights() */
+   SRR_BITWORD*          edgeexists,         /**< bitsets of the edges that may be used on each round */
+   int                   topk,               /**< number of edges each team keeps */
+   SRR_BITWORD*          sparseedges         /**< array to store the bitsets of the candidate edges of each round */
+)
+{
+   SCIP_Real* roundweights;
+   SCIP_Real* maxweight;
+   SCIP_Real* candweights;
+   SCIP_Real summax;
+   int* candteams;
+   int ncands;
+   int nedges;
+   int nwords;
+   int i;
+   int j;
+   int k;
+   int r;
+
+   nedges = (nteams / 2) * (nteams - 1);
+   nwords = SRRbitsetNWords(nedges);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &maxweight, nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candweights, nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candteams, nteams) );
+
+   BMSclearMemoryArray(sparseedges, nrounds * nwords);
+   for (r = 0; r < nrounds; ++r)
+   {
+      roundweights = &weights[r * nedges];
+
+      summax = 0.0;
+      for (i = 0; i < nteams; ++i)
+      {
+         maxweight[i] = -SCIPinfinity(scip);
+         for (j = 0; j < nteams; ++j)
+         {
+            if ( j == i )
+               continue;
+            k = SCIPmatchGetIndex(nteams, i, j);
+            if ( SRRbitsetIsSet(&edgeexists[r * nwords], k) )
+               maxweight[i] = MAX(maxweight[i], roundweights[k]);
+         }
+
+         /* a team without usable edges: the round has no perfect matching, and no candidates */
+         if ( SCIPisInfinity(scip, -maxweight[i]) )
+            break;
+         summax += maxweight[i];
+      }
+      if ( i < nteams )
+         continue;
+
+      for (i = 0; i < nteams; ++i)
+      {
+         ncands = 0;
+         for (j = 0; j < nteams; ++j)
+         {
+            if ( j == i )
+               continue;
+            k = SCIPmatchGetIndex(nteams, i, j);
+            if ( !SRRbitsetIsSet(&edgeexists[r * nwords], k) )
+               continue;
+            if ( !SCIPisGT(scip, sepapi[r] + roundweights[k] + 0.5 * (summax - maxweight[i] - maxweight[j]), 0.0) )
+               continue;
+
+            candweights[ncands] = roundweights[k];
+            candteams[ncands] = j;
+            ++ncands;
+         }
+
+         if ( ncands > topk )
+         {
+            SCIPselectDownRealInt(candweights, candteams, topk, ncands);
+            ncands = topk;
+         }
+         for (j = 0; j < ncands; ++j)
+            SRRbitsetSet(&sparseedges[r * nwords], SCIPmatchGetIndex(nteams, i, candteams[j]));
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &candteams);
+   SCIPfreeBufferArray(scip, &candweights);
+   SCIPfreeBufferArray(scip, &maxweight);
+
+   return SCIP_OKAY;
+}
+
+/** bounds the optimal matching weight of round r from its last exact solve
+ *
+ * Every perfect matching has nteams / 2 edges, so its weight changed by at most nteams / 2 times the largest weight
+ * change on a usable edge since the last exact solve. Removing edges cannot increase the optimum, so the bound only
+ * holds if no edge became usable. Returns FALSE if there is no usable last solve.
+ */
+static
+SCIP_Bool getRoundBound(
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   r,                  /**< round */
+   const SCIP_Real*      weights,            /**< edge weights of round r */
+   const SRR_BITWORD*    edgeexists,         /**< bitset of the edges that may be used on round r */
+   SCIP_Real*            bound               /**< pointer to store the bound on the optimal matching weight */
+)
+{
+   const SCIP_Real* lastweights;
+   const SRR_BITWORD* lastedges;
+   SCIP_Real maxdelta;
+   int nedges;
+   int nwords;
+   int w;
+   int k;
+
+   if ( !pricerdata->lastvalid[r] )
+      return FALSE;
+
+   nedges = (pricerdata->nteams / 2) * (pricerdata->nteams - 1);
+   nwords = SRRbitsetNWords(nedges);
+   lastweights = &pricerdata->lastweights[r * nedges];
+   lastedges = &pricerdata->lastedges[r * nwords];
+
+   for (w = 0; w < nwords; ++w)
+   {
+      if ( (edgeexists[w] & ~lastedges[w]) != 0 )
+         return FALSE;
+   }
+
+   maxdelta = 0.0;
+   for (k = 0; k < nedges; ++k)
+   {
+      if ( SRRbitsetIsSet(edgeexists, k) )
+         maxdelta = MAX(maxdelta, REALABS(weights[k] - lastweights[k]));
+   }
+
+   *bound = pricerdata->lastoptimum[r] + (pricerdata->nteams / 2) * maxdelta;
+
+   return TRUE;
+}
+
+/** builds the 1-factorization of K_nteams by the circle method (Berger tables), with the teams relabeled by perm
+ *
+ * Team nteams - 1 is fixed and the others are placed on a circle. Factor f plays team nteams - 1 against f, and f + d
+ * against f - d modulo nteams - 1, for d = 1, ..., nteams / 2 - 1.
+ */
+static
+void circleFactorization(
+   int                   nteams,             /**< number of teams */
+   const int*            perm,               /**< label of each team */
+   int*                  factors             /**< array to store the opponents of each team in factor f, at f * nteams */
+)
+{
+   int nfactors;
+   int d;
+   int f;
+   int i;
+   int j;
+
+   nfactors = nteams - 1;
+   for (f = 0; f < nfactors; ++f)
+   {
+      i = perm[nteams - 1];
+      j = perm[f];
+      factors[f * nteams + i] = j;
+      factors[f * nteams + j] = i;
+
+      for (d = 1; d < nteams / 2; ++d)
+      {
+         i = perm[(f + d) % nfactors];
+         j = perm[(f - d + nfactors) % nfactors];
+         factors[f * nteams + i] = j;
+         factors[f * nteams + j] = i;
+      }
+   }
+}
+
+/** adds the columns of several 1-factorizations of K_nteams, and tries their schedules as solutions
+ *
+ * The first factorization is the circle method, the others are random relabelings of it. The factors of each are
+ * assigned to the rounds by a minimum cost assignment, which is solved as a matching problem between factors and
+ * rounds. This gives a feasible master LP without Farkas pricing, and, if initsolutions is set, a first incumbent.
+ */
+static
+SCIP_RETCODE addInitialColumns(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int*                  ncolsadded          /**< pointer to increase by the number of added columns */
+)
+{
+   SCIP_Real* coefs;
+   SCIP_CONS** conssmatchingonround;
+   SCIP_CONS** conssmatchisplayed;
+   SCIP_RANDNUMGEN* randnumgen;
+   SRR_MATCHING* assignment;
+   SRR_BITWORD* assignexists;
+   SCIP_Real* assignweights;
+   SCIP_Real assignvalue;
+   SCIP_Real cost;
+   SCIP_Bool feasible;
+   SCIP_Bool added;
+   SCIP_Bool stored;
+   SCIP_SOL* sol;
+   SCIP_VAR* var;
+   int* perm;
+   int* factors;
+   int* mate;
+   int nassignedges;
+   int nfactors;
+   int nteams;
+   int nrounds;
+   int f;
+   int i;
+   int q;
+   int r;
+
+   SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &nrounds, &coefs, &conssmatchingonround,
+      &conssmatchisplayed) );
+   nfactors = nteams - 1;
+
+   /* the assignment is a matching on the factors 0, ..., nfactors - 1 and the rounds nfactors, ..., 2 nfactors - 1 */
+   nassignedges = nfactors * (2 * nfactors - 1);
+   SCIP_CALL( SCIPallocBufferArray(scip, &perm, nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &factors, nfactors * nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &mate, 2 * nfactors) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &assignweights, nassignedges) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &assignexists, SRRbitsetNWords(nassignedges)) );
+   SCIP_CALL( SCIPmatchingCreateSRR(&assignment, 2 * nfactors) );
+   SCIPmatchingSetEngineSRR(assignment, pricerdata->engine);
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, DEFAULT_RANDSEED, TRUE) );
+
+   for (f = 0; f < nfactors; ++f)
+   {
+      for (r = 0; r < nrounds; ++r)
+         SRRbitsetSet(assignexists, SCIPmatchGetIndex(2 * nfactors, f, nfactors + r));
+   }
+
+   for (q = 0; q < pricerdata->initfactorizations; ++q)
+   {
+      for (i = 0; i < nteams; ++i)
+         perm[i] = i;
+      if ( q > 0 )
+         SCIPrandomPermuteIntArray(randnumgen, perm, 0, nteams);
+      circleFactorization(nteams, perm, factors);
+
+      for (f = 0; f < nfactors; ++f)
+      {
+         for (r = 0; r < nrounds; ++r)
+         {
+            cost = 0.0;
+            for (i = 0; i < nteams; ++i)
+            {
+               if ( i < factors[f * nteams + i] )
+                  cost += coefs[factors[f * nteams + i] + i * nteams + r * nteams * nteams];
+            }
+            assignweights[SCIPmatchGetIndex(2 * nfactors, f, nfactors + r)] = -cost;
+         }
+      }
+
+      SCIPmatchingSolveSRR(assignment, assignweights, assignexists, &feasible, &assignvalue, mate);
+      assert( feasible );
+
+      SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+      for (f = 0; f < nfactors; ++f)
+      {
+         r = mate[f] - nfactors;
+         assert( 0 <= r && r < nrounds );
+
+         SCIP_CALL( addMatchingVar(scip, pricerdata, r, &factors[f * nteams], &added, &var) );
+         if ( added )
+            ++(*ncolsadded);
+         SCIP_CALL( SCIPsetSolVal(scip, sol, var, 1.0) );
+      }
+      if ( pricerdata->initsolutions )
+      {
+         SCIP_CALL( SCIPtrySolFree(scip, &sol, FALSE, FALSE, TRUE, TRUE, TRUE, &stored) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPfreeSol(scip, &sol) );
+      }
+   }
+
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIPmatchingFreeSRR(&assignment);
+   SCIPfreeBufferArray(scip, &assignexists);
+   SCIPfreeBufferArray(scip, &assignweights);
+   SCIPfreeBufferArray(scip, &mate);
+   SCIPfreeBufferArray(scip, &factors);
+   SCIPfreeBufferArray(scip, &perm);
+
+   return SCIP_OKAY;
+}
+
+/** adds an artificial column with cost bigm to every round- and match-constraint (phase 1 by big-M)
+ *
+ * The artificial columns keep every node LP feasible, so that Farkas pricing is not needed. The artificial columns of
+ * a smaller penalty are fixed to zero globally.
+ */
+static
+SCIP_RETCODE addArtificialColumns(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int*                  ncolsadded          /**< pointer to increase by the number of added columns */
+)
+{
+   char name[SCIP_MAXSTRLEN];
+   SCIP_Real* coefs;
+   SCIP_CONS** conssmatchingonround;
+   SCIP_CONS** conssmatchisplayed;
+   SCIP_CONS* cons;
+   SCIP_VAR* var;
+   int nteams;
+   int nrounds;
+   int nedges;
+   int i;
+
+   SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &nrounds, &coefs, &conssmatchingonround,
+      &conssmatchisplayed) );
+   nedges = (nteams / 2) * (nteams - 1);
+
+   for (i = 0; i < nrounds + nedges; ++i)
+   {
+      if ( pricerdata->artificials[i] != NULL )
+      {
+         SCIP_CALL( SCIPchgVarUbGlobal(scip, pricerdata->artificials[i], 0.0) );
+         SCIP_CALL( SCIPreleaseVar(scip, &pricerdata->artificials[i]) );
+      }
+
+      if ( i < nrounds )
+      {
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "art_round[%d]", i);
+         SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchingonround[i], &cons) );
+      }
+      else
+      {
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "art_match[%d]", i - nrounds);
+         SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchisplayed[i - nrounds], &cons) );
+      }
+
+      /* the variable data is NULL, which tells the artificial columns from the matchings */
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 0.0, 1.0, pricerdata->bigm, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddPricedVar(scip, var, 1.0) );
+      SCIP_CALL( SCIPaddCoefLinear(scip, cons, var, 1.0) );
+
+      /* a solution with a positive artificial column is no schedule, and the srrmor check rejects it */
+      SCIP_CALL( SCIPaddVarLocksType(scip, var, SCIP_LOCKTYPE_MODEL, 1, 1) );
+      pricerdata->artificials[i] = var;
+   }
+   *ncolsadded += nrounds + nedges;
+
+   return SCIP_OKAY;
+}
+
+/** checks whether a lower bound on the cost of some schedules shows that they cannot improve on the incumbent */
+static
+SCIP_Bool reachesCutoff(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             bound,              /**< lower bound on the cost of the schedules */
+   SCIP_Real             cutoffbound         /**< cutoff bound */
+)
+{
+   if ( SCIPisObjIntegral(scip) )
+      bound = SCIPfeasCeil(scip, bound);
+
+   return SCIPisGE(scip, bound, cutoffbound);
+}
+
+/** removes edges from rounds by reduced cost fixing, and fixes the columns that use them to zero
+ *
+ * For the stored root match duals mu, let z_r be the optimal matching weight of round r and z_r(e) that of the
+ * matchings of round r that contain edge e. Every schedule playing e on round r costs at least L(mu) + z_r - z_r(e),
+ * with L(mu) the Lagrangian bound. If this reaches the cutoff bound, e is removed from round r for the rest of the
+ * solve. Swapping e into the optimal matching gives a lower bound on z_r(e), so only the edges for which the swap does
+ * not already rule out the fixing are solved exactly, with e forced. The rounds of an edge are solved together.
+ */
+static
+SCIP_RETCODE fixRedcostEdges(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   nteams,             /**< number of teams */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            coefs               /**< cost coefficients of the problem */
+)
+{
+   SCIP_VAR** vars;
+   SCIP_VARDATA* vardata;
+   const SRR_BITWORD* varedges;
+   SRR_BITWORD* globaledges;
+   SRR_BITWORD* edgeexists;
+   SCIP_Real* weights;
+   SCIP_Real* minvalues;
+   SCIP_Real* optimum;
+   SCIP_Real* solutionvalues;
+   SCIP_Real lagrangianbound;
+   SCIP_Real cutoffbound;
+   SCIP_Real swapvalue;
+   SCIP_Bool* skip;
+   int* optsolutions;
+   int* solutions;
+   int* nsols;
+   int nvars;
+   int nedges;
+   int nwords;
+   int nsolves;
+   int nfixed;
+   int a;
+   int b;
+   int i;
+   int j;
+   int k;
+   int r;
+   int t;
+   int v;
+   int w;
+
+   nedges = (nteams / 2) * (nteams - 1);
+   nwords = SRRbitsetNWords(nedges);
+   globaledges = pricerdata->globaledges;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgeexists, nrounds * nwords) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &weights, nrounds * nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &minvalues, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &optimum, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solutionvalues, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &skip, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &optsolutions, nrounds * nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solutions, nrounds * nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nsols, nrounds) );
+
+   cutoffbound = SCIPgetCutoffbound(scip);
+   pricerdata->fixcutoff = cutoffbound;
+   pricerdata->fixpending = FALSE;
+   ++pricerdata->nfixings;
+
+   computeWeights(nteams, nrounds, coefs, pricerdata->fixmu, FALSE, weights);
+   for (r = 0; r < nrounds; ++r)
+      minvalues[r] = -SCIPinfinity(scip);
+
+   /* the optimal matchings of the rounds on the edges that are left */
+   SCIPmatchingSolveRoundsSRR(pricerdata->threadpool, pricerdata->matchings, nrounds, 1, weights, globaledges,
+      minvalues, NULL, nsols, optimum, optsolutions);
+   pricerdata->nfixsolves += nrounds;
+
+   lagrangianbound = 0.0;
+   for (k = 0; k < nedges; ++k)
+      lagrangianbound += pricerdata->fixmu[k];
+   for (r = 0; r < nrounds && !SCIPisInfinity(scip, lagrangianbound); ++r)
+   {
+      /* without a perfect matching on some round, no schedule is left; this is for the LP to find out */
+      if ( nsols[r] == 0 )
+         lagrangianbound = SCIPinfinity(scip);
+      else
+         lagrangianbound -= optimum[r];
+   }
+
+   nfixed = 0;
+   for (k = 0; k < nedges && !SCIPisInfinity(scip, lagrangianbound); ++k)
+   {
+      i = pricerdata->edgeteams[2 * k];
+      j = pricerdata->edgeteams[2 * k + 1];
+
+      nsolves = 0;
+      for (r = 0; r < nrounds; ++r)
+      {
+         skip[r] = TRUE;
+         if ( !SRRbitsetIsSet(&globaledges[r * nwords], k) || optsolutions[r * nteams + i] == j )
+            continue;
+
+         /* swapping e into the optimal matching: i-j and a-b instead of i-a and j-b */
+         a = optsolutions[r * nteams + i];
+         b = optsolutions[r * nteams + j];
+         if ( SRRbitsetIsSet(&globaledges[r * nwords], SCIPmatchGetIndex(nteams, MIN(a, b), MAX(a, b))) )
+         {
+            swapvalue = optimum[r] + weights[r * nedges + k]
+               + weights[r * nedges + SCIPmatchGetIndex(nteams, MIN(a, b), MAX(a, b))]
+               - weights[r * nedges + SCIPmatchGetIndex(nteams, MIN(i, a), MAX(i, a))]
+               - weights[r * nedges + SCIPmatchGetIndex(nteams, MIN(j, b), MAX(j, b))];
+            if ( !reachesCutoff(scip, lagrangianbound + optimum[r] - swapvalue, cutoffbound) )
+               continue;
+         }
+
+         /* force e by removing the other edges of i and j */
+         BMScopyMemoryArray(&edgeexists[r * nwords], &globaledges[r * nwords], nwords);
+         for (t = 0; t < nteams; ++t)
+         {
+            if ( t == i || t == j )
+               continue;
+            SRRbitsetUnset(&edgeexists[r * nwords], SCIPmatchGetIndex(nteams, MIN(i, t), MAX(i, t)));
+            SRRbitsetUnset(&edgeexists[r * nwords], SCIPmatchGetIndex(nteams, MIN(j, t), MAX(j, t)));
+         }
+         skip[r] = FALSE;
+         ++nsolves;
+      }
+
+      if ( nsolves == 0 )
+         continue;
+
+      SCIPmatchingSolveRoundsSRR(pricerdata->threadpool, pricerdata->matchings, nrounds, 1, weights, edgeexists,
+         minvalues, skip, nsols, solutionvalues, solutions);
+      pricerdata->nfixsolves += nsolves;
+
+      for (r = 0; r < nrounds; ++r)
+      {
+         if ( !skip[r] && (nsols[r] == 0
+               || reachesCutoff(scip, lagrangianbound + optimum[r] - solutionvalues[r], cutoffbound)) )
+         {
+            SRRbitsetUnset(&globaledges[r * nwords], k);
+            ++nfixed;
+         }
+      }
+   }
+   pricerdata->nfixededges += nfixed;
+
+   /* the columns of matchings with a removed edge cannot be part of an improving schedule anymore */
+   if ( nfixed > 0 )
+   {
+      vars = SCIPgetVars(scip);
+      nvars = SCIPgetNVars(scip);
+      for (v = 0; v < nvars; ++v)
+      {
+         vardata = SCIPvarGetData(vars[v]);
+         if ( vardata == NULL || SCIPisZero(scip, SCIPvarGetUbGlobal(vars[v])) )
+            continue;
+
+         r = SCIPvardataGetRoundSRR(vardata);
+         varedges = SCIPvardataGetEdgesSRR(vardata);
+         for (w = 0; w < nwords; ++w)
+         {
+            if ( (varedges[w] & ~globaledges[r * nwords + w]) != 0 )
+            {
+               SCIP_CALL( SCIPchgVarUbGlobal(scip, vars[v], 0.0) );
+               ++pricerdata->nfixedcols;
+               break;
+            }
+         }
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &nsols);
+   SCIPfreeBufferArray(scip, &solutions);
+   SCIPfreeBufferArray(scip, &optsolutions);
+   SCIPfreeBufferArray(scip, &skip);
+   SCIPfreeBufferArray(scip, &solutionvalues);
+   SCIPfreeBufferArray(scip, &optimum);
+   SCIPfreeBufferArray(scip, &minvalues);
+   SCIPfreeBufferArray(scip, &weights);
+   SCIPfreeBufferArray(scip, &edgeexists);
+
+   return SCIP_OKAY;
+}
+
+/** returns the sum of the duals of the subset-row cuts in which a matching has coefficient one */
+static
+SCIP_Real getSubsetRowDual(
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   ncuts,              /**< number of subset-row cuts */
+   const int*            cutedges,           /**< the three matches of each cut */
+   const SCIP_Real*      cutpi,              /**< duals of the cuts */
+   const int*            solution            /**< opponent of each team in the matching */
+)
+{
+   SCIP_Real value;
+   int count;
+   int c;
+   int l;
+
+   value = 0.0;
+   for (c = 0; c < ncuts; ++c)
+   {
+      if ( cutpi[c] == 0.0 ) /*lint !e777*/
+         continue;
+
+      count = 0;
+      for (l = 0; l < 3; ++l)
+      {
+         if ( solution[pricerdata->edgeteams[2 * cutedges[3 * c + l]]] == pricerdata->edgeteams[2 * cutedges[3 * c + l] + 1] )
+            ++count;
+      }
+      if ( count >= 2 )
+         value += cutpi[c];
+   }
+
+   return value;
+}
+
+/** prices the rounds if some subset-row cuts have non-zero duals
+ *
+ * The dual of a cut counts for the matchings that contain at least two of its matches, which is no sum over edges. As
+ * the duals are non-positive, the weight without the cuts bounds the weight with the cuts from above. So the matchings
+ * of each round are enumerated in order of their weight without cuts by SCIPmatchingSolveKBestSRR(), down to the weight
+ * at which a column becomes improving; the enumeration is complete if fewer matchings than asked for are found. The
+ * number of matchings is doubled for the rounds that are neither complete nor gave a column, up to subsetrowmaxsols
+ * matchings; if no column was found then, resolved is set to FALSE.
+ *
+ * The Lagrangian bound is sum_k mu_k + sum_c sigma_c - sum_r W_r, where W_r bounds the weight with cuts of round r: the
+ * best enumerated weight with cuts, or the weight without cuts of the matchings not enumerated.
+ */
+static
+SCIP_RETCODE priceSubsetRows(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICERDATA*      pricerdata,         /**< pricer data */
+   int                   nteams,             /**< number of teams */
+   int                   nrounds,            /**< number of rounds */
+   SCIP_Real*            coefs,              /**< cost coefficients of the problem */
+   SCIP_Real*            roundpi,            /**< duals of the round-constraints */
+   SCIP_Real*            matchpi,            /**< duals of the match constraints */
+   int                   ncuts,              /**< number of subset-row cuts */
+   const int*            cutedges,           /**< the three matches of each cut */
+   const SCIP_Real*      cutpi,              /**< non-positive duals of the cuts */
+   SCIP_Bool             farkas,             /**< are the duals Farkas multipliers? */
+   SCIP_Real*            weights,            /**< buffer for the edge weights of every round */
+   SRR_BITWORD*          edgeexists,         /**< bitsets of the edges that may be used on each round */
+   int*                  ncolsadded,         /**< pointer to increase by the number of added columns */
+   SCIP_Real*            lagrangianbound,    /**< pointer to store the Lagrangian bound, or -infinity if unknown */
+   SCIP_Bool*            resolved            /**< pointer to store whether every round was priced exactly */
+)
+{
+   SCIP_Real* minvalues;
+   SCIP_Real* solutionvalues;
+   SCIP_Real* roundmax;
+   SCIP_Real value;
+   SCIP_Real cap;
+   SCIP_Bool* done;
+   SCIP_Bool added;
+   int* nsols;
+   int* solutions;
+   int nroundcols;
+   int nedges;
+   int maxsols;
+   int ndone;
+   int c;
+   int k;
+   int r;
+   int s;
+
+   nedges = (nteams / 2) * (nteams - 1);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &minvalues, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &roundmax, nrounds) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &done, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nsols, nrounds) );
+
+   ++pricerdata->nsubsetrowcalls;
+   computeWeights(nteams, nrounds, coefs, matchpi, farkas, weights);
+   for (r = 0; r < nrounds; ++r)
+      minvalues[r] = -roundpi[r];
+
+   ndone = 0;
+   for (maxsols = SUBSETROW_FIRSTSOLS; ; maxsols *= 2)
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &solutionvalues, nrounds * maxsols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &solutions, nrounds * maxsols * nteams) );
+
+      SCIPmatchingSolveRoundsSRR(pricerdata->threadpool, pricerdata->matchings, nrounds, maxsols, weights, edgeexists,
+         minvalues, done, nsols, solutionvalues, solutions);
+
+      for (r = 0; r < nrounds; ++r)
+      {
+         if ( done[r] )
+            continue;
+         pricerdata->nsubsetrowsols += nsols[r];
+
+         /* without a perfect matching, the round has no column at all */
+         if ( nsols[r] == 0 )
+         {
+            roundmax[r] = SCIPinfinity(scip);
+            done[r] = TRUE;
+            ++ndone;
+            continue;
+         }
+
+         /* the matchings that were not enumerated weigh at most the last one, or at most minvalue if all were */
+         if ( nsols[r] < maxsols )
+            cap = MIN(solutionvalues[r * maxsols], minvalues[r]);
+         else
+            cap = solutionvalues[r * maxsols + nsols[r] - 1];
+         roundmax[r] = cap;
+
+         nroundcols = 0;
+         for (s = 0; s < nsols[r]; ++s)
+         {
+            value = solutionvalues[r * maxsols + s] + getSubsetRowDual(pricerdata, ncuts, cutedges, cutpi,
+               &solutions[(r * maxsols + s) * nteams]);
+            roundmax[r] = MAX(roundmax[r], value);
+
+            if ( nroundcols < pricerdata->maxcolsround && SCIPisGT(scip, roundpi[r] + value, 0.0) )
+            {
+               SCIP_CALL( addMatchingVar(scip, pricerdata, r, &solutions[(r * maxsols + s) * nteams], &added, NULL) );
+               if ( added )
+               {
+                  ++nroundcols;
+                  ++(*ncolsadded);
+               }
+            }
+         }
+
+         if ( nroundcols > 0 || nsols[r] < maxsols )
+         {
+            done[r] = TRUE;
+            ++ndone;
+         }
+      }
+
+      SCIPfreeBufferArray(scip, &solutions);
+      SCIPfreeBufferArray(scip, &solutionvalues);
+
+      /* any column lets column generation go on; otherwise the open rounds need more matchings */
+      if ( ndone == nrounds || *ncolsadded > 0 || 2 * maxsols > pricerdata->subsetrowmaxsols )
+         break;
+   }
+   *resolved = ndone == nrounds || *ncolsadded > 0;
+
+   *lagrangianbound = -SCIPinfinity(scip);
+   if ( !farkas )
+   {
+      *lagrangianbound = 0.0;
+      for (k = 0; k < nedges; ++k)
+         *lagrangianbound += matchpi[k];
+      for (c = 0; c < ncuts; ++c)
+         *lagrangianbound += cutpi[c];
+      for (r = 0; r < nrounds && !SCIPisInfinity(scip, -(*lagrangianbound)); ++r)
+      {
+         if ( SCIPisInfinity(scip, roundmax[r]) )
+            *lagrangianbound = -SCIPinfinity(scip);
+         else
+            *lagrangianbound -= roundmax[r];
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &nsols);
+   SCIPfreeBufferArray(scip, &done);
+   SCIPfreeBufferArray(scip, &roundmax);
+   SCIPfreeBufferArray(scip, &minvalues);
+
+   return SCIP_OKAY;
+}
+
+/** solves the pricing problem of every round, and adds the improving columns
+ *
+ * Every exact solve gives the Lagrangian bound sum_k mu_k - sum_r max_M w_r(M) on the LP value of the node, where mu
+ * are the duals of the match constraints priced and w_r are the corresponding matching weights of round r. The best of
+ * these bounds at the node is reported in lowerbound, and used to stop column generation early.
+ *
+ * With dual stabilization, the rounds are priced at a convex combination alpha * center + (1 - alpha) * LP duals of
+ * the stability center (the duals with the best Lagrangian bound at this node) and the LP duals. A matching is only
+ * added if it has negative reduced cost for the LP duals. If no such matching is found (a mispricing), the rounds are
+ * priced again with a smaller alpha, until alpha is zero and the LP duals themselves are used.
+ *
+ * Rounds that cannot price out by the bound of getRoundBound() are not solved; their bound enters the Lagrangian bound.
+ * With partial pricing, an exact pass stops once enough columns are found; it then gives no Lagrangian bound.
+ * With sparse pricing, the rounds are first solved on the candidate edges of computeSparseEdges().
+ * Edges removed by fixRedcostEdges() are left out of every round's graph; the fixing runs once the LP of a node is
+ * solved, if the incumbent or the root multipliers improved since the last time.
  */
-
 static
 SCIP_RETCODE solvePricingSRR(
-   SCIP* scip,
-   SCIP_PRICER* pricer,
-   SCIP_Bool farkas,
-   SCIP_Bool* result
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICER*          pricer,             /**< the pricer */
+   SCIP_Bool             farkas,             /**< price for an infeasible LP with the Farkas multipliers? */
+   SCIP_Real*            lowerbound,         /**< pointer to store a lower bound on the LP value, or NULL if farkas */
+   SCIP_Bool*            stopearly,          /**< pointer to store whether pricing should stop early, or NULL if farkas */
+   SCIP_RESULT*          result              /**< pointer to store the result of the pricing call */
 )
 {
    int i;
-   int j;
    int r;
    int k;
-   SCIP_Real roundpi;
    int nteams;
    int nrounds;
    int nedges;
+   int nwords;
    SCIP_Real* coefs;
    SCIP_CONS** conssmatchingonround;
    SCIP_CONS** conssmatchisplayed;
    SCIP_CONS* cons;
-   SCIP_CONS** conss;
-   int nconss;
+   SCIP_Real* roundpi;
+   SCIP_Real* matchpi;
+   SCIP_Real* sepapi;
+   SCIP_Real* cutpi;
    SCIP_Real* weights;
-   SCIP_Bool* edgeexists;
-   SCIP_Real solutionvalue;
-   SCIP_Real matchingvalue;
-   int* solution;
-   SCIP_VAR* var;
-   SCIP_NODE* node;
-   SCIP_Bool exists;
-   int ii;
-   int jj;
-   int rr;
-   SCIP_Bool permitted;
+   SCIP_ROW** cutrows;
+   int* cutedges;
+   int ncuts;
+   SCIP_Bool subsetrows;
+   SCIP_Bool resolved;
+   int c;
+   SRR_BITWORD* edgeexists;
+   const SRR_BITWORD* allowededges;
+   SCIP_Real* minvalues;
+   SCIP_Real* solutionvalues;
+   int* nsols;
+   int* solutions;
+   SCIP_Bool* heurfound;
+   SCIP_Bool* skipround;
+   SCIP_Bool* batchskip;
+   SRR_BITWORD* sparseedges;
+   SCIP_Real* roundbounds;
+   SCIP_Real* orderscores;
+   int* order;
+   SCIP_Bool partial;
+   SCIP_Bool complete;
+   int batchsize;
+   int nbatch;
+   int b;
+   SCIP_Bool added;
+   SCIP_Real alpha;
+   SCIP_Real alpha0;
+   SCIP_Real lagrangianbound;
+   SCIP_Real artvalue;
+   SCIP_Bool coveringrows;
+   int niters;
+   SCIP_Real lpobj;
+   SCIP_Real bound;
+   SCIP_Longint nodenumber;
+   int maxsols;
+   int t;
    int ncolsadded;
+   SCIP_PRICERDATA* pricerdata;
 
    assert( scip != NULL );
    assert( pricer != NULL );
 
+   pricerdata = SCIPpricerGetData(pricer);
+   assert( pricerdata != NULL );
+   assert( pricerdata->matchings != NULL );
+
    SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &nrounds, &coefs, &conssmatchingonround,
       &conssmatchisplayed) );
 
@@ -139,166 +1526,488 @@ SCIP_RETCODE solvePricingSRR(
    assert( conssmatchingonround != NULL );
    assert( conssmatchisplayed != NULL );
 
+   /* the first call adds the initial columns, and the LP is solved with them before any round is priced */
+   if ( !pricerdata->initcolsadded )
+   {
+      pricerdata->initcolsadded = TRUE;
+      ncolsadded = 0;
+      if ( pricerdata->artificials != NULL )
+      {
+         SCIP_CALL( addArtificialColumns(scip, pricerdata, &ncolsadded) );
+      }
+      if ( pricerdata->initfactorizations > 0 )
+      {
+         SCIP_CALL( addInitialColumns(scip, pricerdata, &ncolsadded) );
+         pricerdata->ncolsinit += ncolsadded;
+      }
+      if ( ncolsadded > 0 )
+      {
+         *result = SCIP_SUCCESS;
+         return SCIP_OKAY;
+      }
+   }
+
+   /* the node's bound from before the LP, such as the combinatorial root bounds, may already reach the incumbent */
+   if ( !farkas && SCIPisGE(scip, SCIPgetLocalLowerbound(scip), SCIPgetCutoffbound(scip)) )
+   {
+      assert( stopearly != NULL );
+      *stopearly = TRUE;
+      ++pricerdata->ncutoffs;
+      *result = SCIP_SUCCESS;
+      return SCIP_OKAY;
+   }
+
    nedges = (nteams / 2) * (nteams - 1);
+   nwords = SRRbitsetNWords(nedges);
+   maxsols = pricerdata->maxcolsround;
+
+   /* while the LP uses artificial columns, its value says nothing about the schedules, so pricing only stops early if
+    * the node is cut off
+    */
+   artvalue = 0.0;
+   if ( !farkas && pricerdata->artificials != NULL )
+   {
+      for (i = 0; i < nrounds + nedges; ++i)
+         artvalue += SCIPvarGetLPSol(pricerdata->artificials[i]);
+   }
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &conss, 1) );  /* Only one constraint is added per node */
-   SCIP_CALL( SCIPallocBufferArray(scip, &weights, nedges) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &edgeexists, nedges) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &solution, nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &roundpi, nrounds + nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sepapi, nrounds + nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &weights, nrounds * nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgeexists, nrounds * nwords) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &minvalues, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nsols, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solutionvalues, nrounds * maxsols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solutions, nrounds * maxsols * nteams) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &heurfound, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &skipround, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &roundbounds, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchskip, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sparseedges, nrounds * nwords) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &orderscores, nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &order, nrounds) );
+   SCIPgetSubsetRowCutsSRR(scip, &ncuts, &cutrows, &cutedges);
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutpi, MAX(ncuts, 1)) );
+
+   /* the duals of the match constraints follow those of the round-constraints */
+   matchpi = &roundpi[nrounds];
 
    *result = SCIP_DIDNOTRUN;
    ncolsadded = 0;
 
+   if ( farkas )
+      ++pricerdata->nfarkascalls;
+   else
+      ++pricerdata->nredcostcalls;
+
+   /* extract the duals once */
    for (r = 0; r < nrounds; ++r)
    {
-
       SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchingonround[r], &cons) );
-      roundpi = farkas?
+      roundpi[r] = farkas?
             SCIPgetDualfarkasLinear(scip, cons):
             SCIPgetDualsolLinear(scip, cons);
+   }
+   for (k = 0; k < nedges; ++k)
+   {
+      SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchisplayed[k], &cons) );
+      matchpi[k] = farkas?
+         SCIPgetDualfarkasLinear(scip, cons):
+         SCIPgetDualsolLinear(scip, cons);
+   }
 
-      k = -1;
-      for (i = 0; i < nteams; ++i)
+   /* the duals of the subset-row cuts are non-positive, as the cuts are <= rows */
+   subsetrows = FALSE;
+   for (c = 0; c < ncuts; ++c)
+   {
+      cutpi[c] = farkas ? SCIPgetRowDualfarkas(scip, cutrows[c]) : SCIPgetRowDualsol(scip, cutrows[c]);
+      cutpi[c] = SCIPisNegative(scip, cutpi[c]) ? cutpi[c] : 0.0;
+      if ( cutpi[c] < 0.0 )
+         subsetrows = TRUE;
+   }
+
+   /* the legal edges on each round follow from the branching decisions of the active SRR MOR constraints, without the
+    * edges removed by reduced cost fixing
+    */
+   for (r = 0; r < nrounds; ++r)
+   {
+      SCIP_CALL( SCIPgetRoundEdgesSRRmor(scip, r, &allowededges, NULL) );
+      for (i = 0; i < nwords; ++i)
+         edgeexists[r * nwords + i] = allowededges[i] & pricerdata->globaledges[r * nwords + i];
+   }
+
+   /* the Lagrangian function depends on the node's branching decisions, so every node gets its own stability center */
+   nodenumber = SCIPnodeGetNumber(SCIPgetCurrentNode(scip));
+   if ( nodenumber != pricerdata->curnode )
+   {
+      pricerdata->curnode = nodenumber;
+      pricerdata->stabcenterbound = -SCIPinfinity(scip);
+      pricerdata->nodebound = -SCIPinfinity(scip);
+      pricerdata->lastlpobj = SCIPinfinity(scip);
+      pricerdata->ntailoff = 0;
+   }
+
+   /* At the first reduced cost call at the root, the subgradient method gives an early bound, and the dual solution of
+    * that bound becomes the first stability center.
+    */
+   if ( !farkas && pricerdata->lagrangianiters > 0 && !pricerdata->lagrangiandone && SCIPgetDepth(scip) == 0 )
+   {
+      pricerdata->lagrangiandone = TRUE;
+      SCIP_CALL( SCIPgetBoolParam(scip, "srr/coveringrows", &coveringrows) );
+      BMScopyMemoryArray(&sepapi[nrounds], matchpi, nedges);
+      SCIP_CALL( SCIPlagrangianSolveSRR(scip, pricerdata->threadpool, pricerdata->matchings, nteams, nrounds, coefs,
+            edgeexists, coveringrows, pricerdata->lagrangianiters, SCIPgetUpperbound(scip), &sepapi[nrounds], sepapi,
+            &lagrangianbound, &niters) );
+      pricerdata->nlagrangianiters += niters;
+      pricerdata->lagrangianrootbound = lagrangianbound;
+      pricerdata->nodebound = MAX(pricerdata->nodebound, lagrangianbound);
+
+      if ( !SCIPisInfinity(scip, lagrangianbound) && lagrangianbound > pricerdata->fixmubound )
       {
-         for (j = i + 1; j < nteams; ++j)
-         {
-            ++k;
-            /* edgeexists and weights arrays follow the natural unordered edge sorting,
-            * that (i,j) < (i',j') if i < i', or i = i' and j < j'.
-            */
+         BMScopyMemoryArray(pricerdata->fixmu, &sepapi[nrounds], nedges);
+         pricerdata->fixmubound = lagrangianbound;
+         pricerdata->fixpending = TRUE;
+      }
 
-            /* is this a legal edge? */
-            node = SCIPgetCurrentNode(scip);
-            exists = TRUE;
-            while (node != NULL)
-            {
-               if ( SCIPnodeGetNAddedConss(node) > 0 )
-               {
-                  assert( SCIPnodeGetNAddedConss(node) == 1 );
-                  SCIPnodeGetAddedConss(node, conss, &nconss, 1);
-
-                  SCIP_CALL( SCIPgetConstraintDataSRRmor(conss[0], &ii, &jj, &rr, &permitted) );
-
-                  /* is edge {i, j} on round `r` permitted? */
-                  if ( permitted )
-                  {
-                     if ( rr == r )
-                     {
-                        if ( ii == i && jj == j )
-                        {
-                           /* Must be the case */
-                        }
-                        else if ( ii == i || jj == j )
-                        {
-                           /* i and j must play against one other. */
-                           exists = FALSE;
-                           break;
-                        }
-                     }
-                     else /* rr != r */
-                     {
-                        if ( ii == i && jj == j )
-                        {
-                           /* i and j must play on r, not on rr. */
-                           exists = FALSE;
-                           break;
-                        }
-                     }
-                  }
-                  else
-                  {
-                     if ( rr == r )
-                     {
-                        if ( ii == i && jj == j )
-                        {
-                           /* i and j must not play against one other. */
-                           exists = FALSE;
-                           break;
-                        }
-                     }
-                  }
-               }
+      if ( pricerdata->stabilization != 'n' && !SCIPisInfinity(scip, lagrangianbound)
+         && lagrangianbound > pricerdata->stabcenterbound )
+      {
+         BMScopyMemoryArray(pricerdata->stabcenter, sepapi, nrounds + nedges);
+         pricerdata->stabcenterbound = lagrangianbound;
+         ++pricerdata->ncenterupdates;
+      }
+   }
+
+   /* With subset-row cuts in the duals, the weights of the matchings are no sums over their edges, so none of the tiers
+    * below applies; the rounds are priced by enumeration instead.
+    */
+   resolved = TRUE;
+   if ( subsetrows )
+   {
+      SCIP_CALL( priceSubsetRows(scip, pricerdata, nteams, nrounds, coefs, roundpi, matchpi, ncuts, cutedges, cutpi,
+            farkas, weights, edgeexists, &ncolsadded, &lagrangianbound, &resolved) );
+      if ( !farkas )
+         pricerdata->nodebound = MAX(pricerdata->nodebound, lagrangianbound);
+   }
+
+   /* re-add the improving matchings of deleted columns; only if there are none, the rounds are solved */
+   if ( pricerdata->poolcap > 0 && !subsetrows )
+   {
+      computeWeights(nteams, nrounds, coefs, matchpi, farkas, weights);
+      SCIP_CALL( pricePool(scip, pricerdata, nrounds, roundpi, weights, edgeexists, solutions, &ncolsadded) );
+   }
+
+   /* Farkas pricing is not stabilized, and neither is the first call at a node, which has no center yet */
+   alpha = 0.0;
+   if ( !farkas && pricerdata->stabilization != 'n' && !SCIPisInfinity(scip, -pricerdata->stabcenterbound) )
+      alpha = pricerdata->stabilization == 'i' ? pricerdata->stabalpha : pricerdata->alpha;
+   alpha0 = alpha;
+
+   for (t = 1; ncolsadded == 0 && !subsetrows; ++t)
+   {
+      /* the separation point */
+      for (i = 0; i < nrounds + nedges; ++i)
+         sepapi[i] = alpha * pricerdata->stabcenter[i] + (1.0 - alpha) * roundpi[i];
+
+      /* a matching is improving if its weight exceeds -roundpi */
+      for (r = 0; r < nrounds; ++r)
+         minvalues[r] = -sepapi[r];
+      computeWeights(nteams, nrounds, coefs, &sepapi[nrounds], farkas, weights);
+
+      /* First try the greedy and 2-opt matchings. Any improving column is enough to continue column generation; only
+       * if the heuristics find none, the exact solve below is needed to prove that the LP is optimal.
+       */
+      if ( pricerdata->heuristic )
+      {
+         SCIPmatchingHeuristicRoundsSRR(pricerdata->threadpool, pricerdata->matchings, nrounds, weights, edgeexists,
+            heurfound, solutionvalues, solutions);
 
-               node = SCIPnodeGetParent(node);
+         for (r = 0; r < nrounds; ++r)
+         {
+            if ( heurfound[r] && SCIPisGT(scip, getMatchingRedvalue(nteams, r, coefs, roundpi[r], matchpi, farkas,
+                     &solutions[r * nteams]), 0.0) )
+            {
+               SCIP_CALL( addMatchingVar(scip, pricerdata, r, &solutions[r * nteams], &added, NULL) );
+               if ( added )
+                  ++ncolsadded;
             }
-            edgeexists[k] = exists;  /* No branching decisions, yet ... */
+         }
 
-            SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchisplayed[k], &cons) );
-            weights[k] = farkas?
-               SCIPgetDualfarkasLinear(scip, cons):
-               SCIPgetDualsolLinear(scip, cons) - coefs[j + i * nteams + r * nteams * nteams];
-            assert( coefs[i + j * nteams + r * nteams * nteams] == coefs[j + i * nteams + r * nteams * nteams] );
+         if ( ncolsadded > 0 )
+         {
+            ++pricerdata->nheurpasses;
+            pricerdata->ncolsheur += ncolsadded;
+            break;
          }
       }
 
-      SCIPmatchingSolveSRR(nteams, weights, edgeexists, &solutionvalue, solution);
+      /* A round whose bound on the optimal matching weight shows that no matching is improving at the separation
+       * point need not be solved. The in-out update needs the optimal matchings of all rounds, so nothing is skipped
+       * then.
+       */
+      if ( pricerdata->lastfarkas != farkas )
+      {
+         BMSclearMemoryArray(pricerdata->lastvalid, nrounds);
+         pricerdata->lastfarkas = farkas;
+      }
+      for (r = 0; r < nrounds; ++r)
+      {
+         skipround[r] = pricerdata->skiprounds && !(t == 1 && alpha > 0.0 && pricerdata->stabilization == 'i')
+            && getRoundBound(pricerdata, r, &weights[r * nedges], &edgeexists[r * nwords], &roundbounds[r])
+            && !SCIPisGT(scip, sepapi[r] + roundbounds[r], 0.0);
+      }
 
-      /* If this matching is improving, add it! */
-      if ( SCIPisGT(scip, roundpi + solutionvalue, 0.0) )
+      /* Then solve the rounds on their sparse candidate edges. Every matching found is a matching of the full graph, so
+       * any improving one is a valid column; only if there is none, the exact solve below is needed.
+       */
+      if ( pricerdata->sparsetopk > 0 && pricerdata->sparsetopk < nteams - 1 )
       {
-         /*
-         SCIPdebugMessage("Adding ");
-         for (i = 0; i < nteams; ++i)
-            if ( i < solution[i] ) SCIPdebugMessage("%d-%d, ", i, solution[i]);
-         SCIPdebugMessage("on round %d (Farkas %d, Roundpi %lf, Solution %lf, Total %lf)\n", r, farkas, roundpi,
-            solutionvalue, roundpi + solutionvalue);
-         */
+         SCIP_CALL( computeSparseEdges(scip, nteams, nrounds, sepapi, weights, edgeexists, pricerdata->sparsetopk,
+               sparseedges) );
+         SCIPmatchingSolveRoundsSRR(pricerdata->threadpool, pricerdata->matchings, nrounds, maxsols, weights,
+            sparseedges, minvalues, skipround, nsols, solutionvalues, solutions);
+         ++pricerdata->nsparsepasses;
 
-         matchingvalue = 0.0;
-         for (i = 0; i < nteams; ++i)
+         for (r = 0; r < nrounds; ++r)
          {
-            j = solution[i];
-            assert( i == solution[j] );
-            if ( i < j )
-               matchingvalue += coefs[j + i * nteams + r * nteams * nteams];
+            SCIP_CALL( addRoundColumns(scip, pricerdata, r, coefs, roundpi, matchpi, sepapi, farkas, maxsols, nsols,
+                  solutionvalues, solutions, &ncolsadded) );
          }
 
+         if ( ncolsadded > 0 )
+         {
+            pricerdata->ncolssparse += ncolsadded;
+            break;
+         }
+      }
 
-         /* create and add variable */
-         SCIP_CALL( SCIPcreateVarBasic(scip, &var, NULL, 0.0, 1.0, matchingvalue, SCIP_VARTYPE_BINARY) );
-         SCIPvarSetData(var, (SCIP_VARDATA*) (long) r);
-         SCIP_CALL( SCIPvarSetInitial(var, TRUE) );
-         SCIP_CALL( SCIPvarSetRemovable(var, TRUE) );
-         SCIPvarMarkDeletable(var);
-         SCIP_CALL( SCIPaddPricedVar(scip, var, 1.0) );
-         SCIPdebugMsg(scip, "added variable %i\n", SCIPgetNVars(scip));
-         /* catch variable deleted event on the variable to update the stablesetvars array in the problem data */
-         SCIP_CALL( SCIPcatchVarEvent(scip, var, SCIP_EVENTTYPE_VARDELETED, SCIPfindEventhdlr(scip, EVENTHDLR_NAME),
-            NULL, NULL) );
-
-         /* set coefficient in round-constraint */
-         SCIPgetTransformedCons(scip, conssmatchingonround[r], &cons);
-         SCIP_CALL( SCIPaddCoefLinear(scip, cons, var, 1.0) );
+      /* With partial pricing, the rounds are solved in batches of nthreads rounds, best reduced value of their last
+       * solve first, until partialcols columns are found. Only a complete pass gives the Lagrangian bound, and the
+       * in-out update needs one, so the first separation point of in-out stabilization is always priced completely.
+       */
+      partial = pricerdata->partialcols > 0 && !(t == 1 && alpha > 0.0 && pricerdata->stabilization == 'i');
+      for (r = 0; r < nrounds; ++r)
+      {
+         order[r] = r;
+         orderscores[r] = pricerdata->roundscores[r];
+      }
+      if ( partial )
+         SCIPsortDownRealInt(orderscores, order, nrounds);
+      batchsize = partial ? pricerdata->nthreads : nrounds;
+      ++pricerdata->nexactpasses;
 
-         /* set coefficient in matching constraint */
-         k = -1;
-         for (i = 0; i < nteams; ++i)
+      for (b = 0; b < nrounds && !(partial && ncolsadded >= pricerdata->partialcols); b += batchsize)
+      {
+         nbatch = MIN(batchsize, nrounds - b);
+         for (r = 0; r < nrounds; ++r)
+            batchskip[r] = TRUE;
+         for (i = b; i < b + nbatch; ++i)
+            batchskip[order[i]] = skipround[order[i]];
+
+         /* the rounds are independent given the duals: solve them (possibly in parallel), each giving the maxsols best
+          * matchings
+          */
+         SCIPmatchingSolveRoundsSRR(pricerdata->threadpool, pricerdata->matchings, nrounds, maxsols, weights,
+            edgeexists, minvalues, batchskip, nsols, solutionvalues, solutions);
+
+         /* add the columns in the order of the rounds, such that the result does not depend on the number of threads
+          * (unless pricing is partial)
+          */
+         for (i = b; i < b + nbatch; ++i)
          {
-            for (j = i + 1; j < nteams; ++j)
+            r = order[i];
+            if ( skipround[r] )
             {
-               ++k;
-               /* edgeexists and weights arrays follow the natural unordered edge sorting,
-                * that (i,j) < (i',j') if i < i', or i = i' and j < j'.
-                */
-               if ( solution[i] == j )
-               {
-                  SCIP_CALL( SCIPgetTransformedCons(scip, conssmatchisplayed[k], &cons) );
-                  SCIP_CALL( SCIPaddCoefLinear(scip, cons, var, 1.0) );
-               }
+               ++pricerdata->nskippedrounds;
+               continue;
+            }
+
+            /* from now on, roundbounds holds the optimal matching weight of the solved rounds as well */
+            pricerdata->lastvalid[r] = nsols[r] > 0;
+            if ( nsols[r] > 0 )
+            {
+               roundbounds[r] = solutionvalues[r * maxsols];
+               pricerdata->roundscores[r] = sepapi[r] + solutionvalues[r * maxsols];
+               pricerdata->lastoptimum[r] = solutionvalues[r * maxsols];
+               BMScopyMemoryArray(&pricerdata->lastweights[r * nedges], &weights[r * nedges], nedges);
+               BMScopyMemoryArray(&pricerdata->lastedges[r * nwords], &edgeexists[r * nwords], nwords);
+            }
+            else
+            {
+               roundbounds[r] = SCIPinfinity(scip);
+               pricerdata->roundscores[r] = -SCIPinfinity(scip);
             }
+
+            SCIP_CALL( addRoundColumns(scip, pricerdata, r, coefs, roundpi, matchpi, sepapi, farkas, maxsols, nsols,
+                  solutionvalues, solutions, &ncolsadded) );
+         }
+      }
+      complete = b >= nrounds;
+      if ( !complete )
+         ++pricerdata->npartialstops;
+
+      /* The Lagrangian bound at the separation point is the sum of the match duals minus the optimal matching weights.
+       * It is only known if every round has a perfect matching. Skipped rounds contribute their bound instead.
+       */
+      if ( !farkas && complete )
+      {
+         lagrangianbound = 0.0;
+         for (k = 0; k < nedges; ++k)
+            lagrangianbound += sepapi[nrounds + k];
+         for (r = 0; r < nrounds && !SCIPisInfinity(scip, -lagrangianbound); ++r)
+         {
+            if ( SCIPisInfinity(scip, roundbounds[r]) )
+               lagrangianbound = -SCIPinfinity(scip);
+            else
+               lagrangianbound -= roundbounds[r];
+         }
+
+         /* in-out stabilization adapts alpha once per call, at the first separation point */
+         if ( t == 1 && alpha > 0.0 && pricerdata->stabilization == 'i' && !SCIPisInfinity(scip, -lagrangianbound) )
+            updateInOutAlpha(pricerdata, nteams, nrounds, matchpi, solutions, maxsols);
+
+         pricerdata->nodebound = MAX(pricerdata->nodebound, lagrangianbound);
+
+         /* the best root multipliers are kept for reduced cost fixing */
+         if ( SCIPgetDepth(scip) == 0 && lagrangianbound > pricerdata->fixmubound )
+         {
+            BMScopyMemoryArray(pricerdata->fixmu, &sepapi[nrounds], nedges);
+            pricerdata->fixmubound = lagrangianbound;
+            pricerdata->fixpending = TRUE;
+         }
+
+         if ( pricerdata->stabilization != 'n' && lagrangianbound > pricerdata->stabcenterbound )
+         {
+            BMScopyMemoryArray(pricerdata->stabcenter, sepapi, nrounds + nedges);
+            pricerdata->stabcenterbound = lagrangianbound;
+            ++pricerdata->ncenterupdates;
+         }
+      }
+      pricerdata->ncolsexact += ncolsadded;
+
+      if ( ncolsadded > 0 || alpha == 0.0 ) /*lint !e777*/
+         break;
+
+      /* mispricing: move the separation point towards the LP duals */
+      ++pricerdata->nmispricings;
+      alpha = MAX(0.0, 1.0 - (t + 1) * (1.0 - alpha0));
+   }
+
+   /* Phase 1 by big-M: if the LP is optimal but uses artificial columns, either the penalty is too small or the node
+    * is infeasible. The LP value of a feasible node is at most the cost of a solution without artificial columns, which
+    * is at most artbound. So an LP value above artbound proves infeasibility; otherwise the penalty is raised.
+    */
+   if ( !farkas && ncolsadded == 0 && pricerdata->artificials != NULL )
+   {
+      if ( SCIPisFeasPositive(scip, artvalue) )
+      {
+         if ( SCIPisGT(scip, SCIPgetLPObjval(scip), pricerdata->artbound) )
+         {
+            pricerdata->nodebound = SCIPinfinity(scip);
+            ++pricerdata->nartcutoffs;
+         }
+         else
+         {
+            pricerdata->bigm *= 10.0;
+            SCIP_CALL( addArtificialColumns(scip, pricerdata, &ncolsadded) );
+            ++pricerdata->nbigmincreases;
+         }
+      }
+   }
+
+   /* Once the LP of the node is solved, remove the edges that cannot be part of a schedule better than the incumbent.
+    * This only needs to be repeated if the incumbent or the root multipliers improved.
+    */
+   if ( !farkas && ncolsadded == 0 && pricerdata->redcostfixing && !SCIPisInfinity(scip, -pricerdata->fixmubound)
+      && !SCIPisInfinity(scip, SCIPgetCutoffbound(scip))
+      && (pricerdata->fixpending || SCIPisLT(scip, SCIPgetCutoffbound(scip), pricerdata->fixcutoff)) )
+   {
+      SCIP_CALL( fixRedcostEdges(scip, pricerdata, nteams, nrounds, coefs) );
+   }
+
+   /* report the Lagrangian bound, and stop column generation if it cannot change the outcome of the node anymore */
+   if ( !farkas && !SCIPisInfinity(scip, -pricerdata->nodebound) )
+   {
+      assert( lowerbound != NULL );
+      assert( stopearly != NULL );
+
+      bound = pricerdata->nodebound;
+      lpobj = SCIPgetLPObjval(scip);
+      if ( SCIPisObjIntegral(scip) )
+      {
+         bound = SCIPfeasCeil(scip, bound);
+         lpobj = SCIPfeasCeil(scip, lpobj);
+      }
+      *lowerbound = bound;
+
+      if ( ncolsadded > 0 )
+      {
+         if ( SCIPisGE(scip, bound, SCIPgetCutoffbound(scip)) )
+         {
+            /* the node will be cut off */
+            *stopearly = TRUE;
+            ++pricerdata->ncutoffs;
+         }
+         else if ( pricerdata->earlybranching && SCIPisGE(scip, bound, lpobj) && !SCIPisFeasPositive(scip, artvalue) )
+         {
+            /* the LP value can only decrease to the bound, so the node's bound cannot improve by further pricing */
+            *stopearly = TRUE;
+            ++pricerdata->nearlybranchings;
          }
+      }
+   }
+
+   /* a round whose enumeration was cut short may still have an improving column, so the LP is not proven optimal */
+   if ( !farkas && !resolved )
+   {
+      assert( stopearly != NULL );
+      *stopearly = TRUE;
+      ++pricerdata->nsubsetrowstops;
+   }
 
-         ++ncolsadded;
+   /* tailing off: the LP value hardly decreased over the last tailoffiters calls at this node */
+   if ( !farkas && ncolsadded > 0 && pricerdata->tailoffiters > 0 && !*stopearly
+      && !SCIPisFeasPositive(scip, artvalue) )
+   {
+      lpobj = SCIPgetLPObjval(scip);
+      if ( !SCIPisInfinity(scip, pricerdata->lastlpobj)
+         && pricerdata->lastlpobj - lpobj <= pricerdata->tailoffgap * MAX(1.0, REALABS(lpobj)) )
+         ++pricerdata->ntailoff;
+      else
+         pricerdata->ntailoff = 0;
+      pricerdata->lastlpobj = lpobj;
+
+      if ( pricerdata->ntailoff >= pricerdata->tailoffiters )
+      {
+         *stopearly = TRUE;
+         ++pricerdata->ntailoffbranchings;
       }
    }
 
-   SCIPfreeBufferArray(scip, &solution);
+   /* no column prices out and pricing was not stopped: the LP value is the value of the master relaxation */
+   if ( !farkas && ncolsadded == 0 && !*stopearly && SCIPgetDepth(scip) == 0
+      && !SCIPisInfinity(scip, pricerdata->nodebound) )
+      pricerdata->rootlpobj = SCIPgetLPObjval(scip);
+
+   SCIPfreeBufferArray(scip, &cutpi);
+   SCIPfreeBufferArray(scip, &order);
+   SCIPfreeBufferArray(scip, &orderscores);
+   SCIPfreeBufferArray(scip, &sparseedges);
+   SCIPfreeBufferArray(scip, &batchskip);
+   SCIPfreeBufferArray(scip, &roundbounds);
+   SCIPfreeBufferArray(scip, &skipround);
+   SCIPfreeBufferArray(scip, &heurfound);
+   SCIPfreeBufferArray(scip, &solutions);
+   SCIPfreeBufferArray(scip, &solutionvalues);
+   SCIPfreeBufferArray(scip, &nsols);
+   SCIPfreeBufferArray(scip, &minvalues);
    SCIPfreeBufferArray(scip, &edgeexists);
    SCIPfreeBufferArray(scip, &weights);
-   SCIPfreeBufferArray(scip, &conss);
+   SCIPfreeBufferArray(scip, &sepapi);
+   SCIPfreeBufferArray(scip, &roundpi);
 
-   /* not finding a variable is also success */
-   *result = SCIP_SUCCESS;
+   /* not finding a variable is also success, unless some round could not be priced exactly with the subset-row cuts */
+   *result = farkas && !resolved ? SCIP_DIDNOTRUN : SCIP_SUCCESS;
 
    return SCIP_OKAY;
 }
@@ -316,6 +2025,14 @@ SCIP_RETCODE solvePricingSRR(
 static
 SCIP_DECL_PRICERFREE(pricerFreeSRR)
 {  /*lint --e{715}*/
+   SCIP_PRICERDATA* pricerdata;
+
+   pricerdata = SCIPpricerGetData(pricer);
+   assert( pricerdata != NULL );
+
+   SCIPfreeBlockMemory(scip, &pricerdata);
+   SCIPpricerSetData(pricer, NULL);
+
    return SCIP_OKAY;
 }
 
@@ -323,6 +2040,43 @@ SCIP_DECL_PRICERFREE(pricerFreeSRR)
 static
 SCIP_DECL_PRICERINIT(pricerInitSRR)
 {  /*lint --e{715}*/
+   SCIP_PRICERDATA* pricerdata;
+
+   pricerdata = SCIPpricerGetData(pricer);
+   assert( pricerdata != NULL );
+
+   pricerdata->nredcostcalls = 0;
+   pricerdata->nfarkascalls = 0;
+   pricerdata->nexactpasses = 0;
+   pricerdata->nheurpasses = 0;
+   pricerdata->ncolsexact = 0;
+   pricerdata->ncolsheur = 0;
+   pricerdata->nmispricings = 0;
+   pricerdata->ncenterupdates = 0;
+   pricerdata->ncutoffs = 0;
+   pricerdata->nearlybranchings = 0;
+   pricerdata->ntailoffbranchings = 0;
+   pricerdata->npoolinserts = 0;
+   pricerdata->npooloverwrites = 0;
+   pricerdata->npoolhits = 0;
+   pricerdata->npoolmisses = 0;
+   pricerdata->nduplicates = 0;
+   pricerdata->nskippedrounds = 0;
+   pricerdata->npartialstops = 0;
+   pricerdata->nsparsepasses = 0;
+   pricerdata->nbigmincreases = 0;
+   pricerdata->nlagrangianiters = 0;
+   pricerdata->nartcutoffs = 0;
+   pricerdata->ncolsinit = 0;
+   pricerdata->ncolssparse = 0;
+   pricerdata->nfixings = 0;
+   pricerdata->nfixsolves = 0;
+   pricerdata->nfixededges = 0;
+   pricerdata->nfixedcols = 0;
+   pricerdata->nsubsetrowcalls = 0;
+   pricerdata->nsubsetrowsols = 0;
+   pricerdata->nsubsetrowstops = 0;
+
    return SCIP_OKAY;
 }
 
@@ -333,12 +2087,182 @@ SCIP_DECL_PRICEREXIT(pricerExitSRR)
    return SCIP_OKAY;
 }
 
+/** solving process initialization method of variable pricer (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_PRICERINITSOL(pricerInitsolSRR)
+{  /*lint --e{715}*/
+   SCIP_PRICERDATA* pricerdata;
+   SCIP_Real* coefs;
+   SCIP_CONS** conssmatchingonround;
+   SCIP_CONS** conssmatchisplayed;
+   SCIP_Real maxcoef;
+   SCIP_Real maxabscoef;
+   int nteams;
+   int nedges;
+   int i;
+   int j;
+   int r;
+
+   pricerdata = SCIPpricerGetData(pricer);
+   assert( pricerdata != NULL );
+
+   SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &pricerdata->nrounds, &coefs, &conssmatchingonround,
+      &conssmatchisplayed) );
+   nedges = (nteams / 2) * (nteams - 1);
+
+   /* the matching data is built once per round, and reused in every pricing call */
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &pricerdata->matchings, pricerdata->nrounds) );
+   for (r = 0; r < pricerdata->nrounds; ++r)
+   {
+      SCIP_CALL( SCIPmatchingCreateSRR(&pricerdata->matchings[r], nteams) );
+      SCIPmatchingSetEngineSRR(pricerdata->matchings[r], pricerdata->engine);
+   }
+
+   pricerdata->threadpool = NULL;
+   if ( pricerdata->nthreads > 1 )
+   {
+      SCIP_CALL( SCIPthreadpoolCreateSRR(&pricerdata->threadpool, pricerdata->nthreads) );
+   }
+
+   /* the stability center holds the round duals followed by the match duals */
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &pricerdata->stabcenter, pricerdata->nrounds + nedges) );
+   pricerdata->stabcenterbound = -SCIPinfinity(scip);
+   pricerdata->curnode = -1;
+   pricerdata->initcolsadded = FALSE;
+   pricerdata->lagrangiandone = FALSE;
+   pricerdata->lagrangianrootbound = -SCIPinfinity(scip);
+   pricerdata->rootlpobj = -SCIPinfinity(scip);
+   pricerdata->stabalpha = pricerdata->alpha;
+
+   /* the last exact solve of each round, for skipping rounds that cannot price out */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pricerdata->lastweights, pricerdata->nrounds * nedges) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pricerdata->lastedges, pricerdata->nrounds * SRRbitsetNWords(nedges)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pricerdata->lastoptimum, pricerdata->nrounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &pricerdata->lastvalid, pricerdata->nrounds) );
+   pricerdata->lastfarkas = FALSE;
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &pricerdata->roundscores, pricerdata->nrounds) );
+
+   /* all edges are usable until reduced cost fixing removes them */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pricerdata->globaledges, pricerdata->nrounds * SRRbitsetNWords(nedges)) );
+   for (r = 0; r < pricerdata->nrounds; ++r)
+      SRRbitsetSetAll(&pricerdata->globaledges[r * SRRbitsetNWords(nedges)], nedges);
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &pricerdata->fixmu, nedges) );
+   pricerdata->fixmubound = -SCIPinfinity(scip);
+   pricerdata->fixcutoff = SCIPinfinity(scip);
+   pricerdata->fixpending = FALSE;
+
+   /* Phase 1 by big-M: a schedule costs at most nteams / 2 times the largest coefficient per round; the first penalty
+    * is the largest cost of one matching
+    */
+   pricerdata->artificials = NULL;
+   if ( pricerdata->phaseone == 'b' )
+   {
+      SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &pricerdata->artificials, pricerdata->nrounds + nedges) );
+      maxcoef = -SCIPinfinity(scip);
+      maxabscoef = 0.0;
+      for (i = 0; i < nteams * nteams * pricerdata->nrounds; ++i)
+      {
+         maxcoef = MAX(maxcoef, coefs[i]);
+         maxabscoef = MAX(maxabscoef, REALABS(coefs[i]));
+      }
+      pricerdata->artbound = pricerdata->nrounds * (nteams / 2) * maxcoef;
+      pricerdata->bigm = (nteams / 2) * maxabscoef + 1.0;
+   }
+
+   /* records of the priced columns, and the pool of the matchings of deleted columns */
+   pricerdata->nteams = nteams;
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pricerdata->edgeteams, 2 * nedges) );
+   for (i = 0; i < nteams; ++i)
+   {
+      for (j = i + 1; j < nteams; ++j)
+      {
+         pricerdata->edgeteams[2 * SCIPmatchGetIndex(nteams, i, j)] = i;
+         pricerdata->edgeteams[2 * SCIPmatchGetIndex(nteams, i, j) + 1] = j;
+      }
+   }
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pricerdata->colindex, pricerdata->nrounds) );
+   for (r = 0; r < pricerdata->nrounds; ++r)
+   {
+      SCIP_CALL( SCIPhashtableCreate(&pricerdata->colindex[r], SCIPblkmem(scip), 100, hashGetKeyColumn,
+            hashKeyEqColumn, hashKeyValColumn, (void*) pricerdata) );
+   }
+
+   /* the pool holds nrounds * poolcap * nteams / 2 edges, which must fit into an int */
+   pricerdata->poolcap = pricerdata->poolsize > 0 ? MAX(pricerdata->poolsize / pricerdata->nrounds, 1) : 0;
+   pricerdata->poolcap = MIN(pricerdata->poolcap, INT_MAX / (pricerdata->nrounds * (nteams / 2)));
+   pricerdata->pool = NULL;
+   if ( pricerdata->poolcap > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pricerdata->pool, pricerdata->nrounds * pricerdata->poolcap * (nteams / 2)) );
+   }
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &pricerdata->npool, pricerdata->nrounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &pricerdata->poolnext, pricerdata->nrounds) );
+
+   return SCIP_OKAY;
+}
+
+/** solving process deinitialization method of variable pricer (called before branch and bound process data is freed) */
+static
+SCIP_DECL_PRICEREXITSOL(pricerExitsolSRR)
+{  /*lint --e{715}*/
+   SCIP_PRICERDATA* pricerdata;
+   int nedges;
+   int r;
+
+   pricerdata = SCIPpricerGetData(pricer);
+   assert( pricerdata != NULL );
+
+   if ( pricerdata->threadpool != NULL )
+      SCIPthreadpoolFreeSRR(&pricerdata->threadpool);
+
+   nedges = (pricerdata->nteams / 2) * (pricerdata->nteams - 1);
+   if ( pricerdata->artificials != NULL )
+   {
+      for (r = 0; r < pricerdata->nrounds + nedges; ++r)
+      {
+         if ( pricerdata->artificials[r] != NULL )
+         {
+            SCIP_CALL( SCIPreleaseVar(scip, &pricerdata->artificials[r]) );
+         }
+      }
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->stabcenter, pricerdata->nrounds + nedges);
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->artificials, pricerdata->nrounds + nedges);
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->roundscores, pricerdata->nrounds);
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->fixmu, nedges);
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->globaledges, pricerdata->nrounds * SRRbitsetNWords(nedges));
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->lastvalid, pricerdata->nrounds);
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->lastoptimum, pricerdata->nrounds);
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->lastedges, pricerdata->nrounds * SRRbitsetNWords(nedges));
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->lastweights, pricerdata->nrounds * nedges);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->poolnext, pricerdata->nrounds);
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->npool, pricerdata->nrounds);
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->pool, pricerdata->nrounds * pricerdata->poolcap * (pricerdata->nteams / 2));
+   if ( pricerdata->colindex != NULL )
+   {
+      for (r = 0; r < pricerdata->nrounds; ++r)
+         SCIPhashtableFree(&pricerdata->colindex[r]);
+      SCIPfreeBlockMemoryArray(scip, &pricerdata->colindex, pricerdata->nrounds);
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->edgeteams, 2 * nedges);
+
+   if ( pricerdata->matchings != NULL )
+   {
+      for (r = 0; r < pricerdata->nrounds; ++r)
+         SCIPmatchingFreeSRR(&pricerdata->matchings[r]);
+      SCIPfreeBlockMemoryArray(scip, &pricerdata->matchings, pricerdata->nrounds);
+   }
+
+   return SCIP_OKAY;
+}
+
 /** reduced cost pricing method of variable pricer for feasible LPs */
 static
 SCIP_DECL_PRICERREDCOST(pricerRedcostSRR)
 {  /*lint --e{715}*/
 
-   solvePricingSRR(scip, pricer, FALSE, result);
+   SCIP_CALL( solvePricingSRR(scip, pricer, FALSE, lowerbound, stopearly, result) );
 
    return SCIP_OKAY;
 }
@@ -348,7 +2272,56 @@ static
 SCIP_DECL_PRICERFARKAS(pricerFarkasSRR)
 {  /*lint --e{715}*/
 
-   solvePricingSRR(scip, pricer, TRUE, result);
+   SCIP_CALL( solvePricingSRR(scip, pricer, TRUE, NULL, NULL, result) );
+
+   return SCIP_OKAY;
+}
+
+/** output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUT(tableOutputSRR)
+{  /*lint --e{715}*/
+   SCIP_PRICER* pricer;
+   SCIP_PRICERDATA* pricerdata;
+
+   pricer = SCIPfindPricer(scip, PRICER_NAME);
+   assert( pricer != NULL );
+
+   pricerdata = SCIPpricerGetData(pricer);
+   assert( pricerdata != NULL );
+
+   SCIPinfoMessage(scip, file, "Matching pricer    :   Redcost     Farkas ExactPass  HeurPass  ColsExact   ColsHeur Mispricing CenterUpd\n");
+   SCIPinfoMessage(scip, file, "  %-17.17s: %9" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT
+      " %9" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT
+      " %9" SCIP_LONGINT_FORMAT "\n", PRICER_NAME, pricerdata->nredcostcalls, pricerdata->nfarkascalls,
+      pricerdata->nexactpasses, pricerdata->nheurpasses, pricerdata->ncolsexact, pricerdata->ncolsheur,
+      pricerdata->nmispricings, pricerdata->ncenterupdates);
+   SCIPinfoMessage(scip, file, "Matching bounds    :   Cutoffs   EarlyBr   TailOff SkipRound   Partial\n");
+   SCIPinfoMessage(scip, file, "  %-17.17s: %9" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT
+      " %9" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT "\n", PRICER_NAME, pricerdata->ncutoffs,
+      pricerdata->nearlybranchings, pricerdata->ntailoffbranchings, pricerdata->nskippedrounds,
+      pricerdata->npartialstops);
+   SCIPinfoMessage(scip, file, "Matching pool      :   Inserts Overwrites      Hits    Misses Duplicates\n");
+   SCIPinfoMessage(scip, file, "  %-17.17s: %9" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT
+      " %9" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT "\n", PRICER_NAME, pricerdata->npoolinserts,
+      pricerdata->npooloverwrites, pricerdata->npoolhits, pricerdata->npoolmisses, pricerdata->nduplicates);
+   SCIPinfoMessage(scip, file, "Matching sparse    :    Passes      Cols  InitCols\n");
+   SCIPinfoMessage(scip, file, "  %-17.17s: %9" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT "\n",
+      PRICER_NAME, pricerdata->nsparsepasses, pricerdata->ncolssparse, pricerdata->ncolsinit);
+   SCIPinfoMessage(scip, file, "Matching Lagrange  :      Iters      Bound\n");
+   SCIPinfoMessage(scip, file, "  %-17.17s: %10" SCIP_LONGINT_FORMAT " %10.4g\n", PRICER_NAME,
+      pricerdata->nlagrangianiters, pricerdata->lagrangianrootbound);
+   SCIPinfoMessage(scip, file, "Matching phase 1   :  BigMRaise Infeasible\n");
+   SCIPinfoMessage(scip, file, "  %-17.17s: %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT "\n", PRICER_NAME,
+      pricerdata->nbigmincreases, pricerdata->nartcutoffs);
+
+   SCIPinfoMessage(scip, file, "Matching redcost   :    Runs    Solves FixedEdges FixedCols\n");
+   SCIPinfoMessage(scip, file, "  %-17.17s: %7" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT
+      " %9" SCIP_LONGINT_FORMAT "\n", PRICER_NAME, pricerdata->nfixings, pricerdata->nfixsolves,
+      pricerdata->nfixededges, pricerdata->nfixedcols);
+   SCIPinfoMessage(scip, file, "Matching subsetrow :     Calls  Enumerated     Stops\n");
+   SCIPinfoMessage(scip, file, "  %-17.17s: %9" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %9" SCIP_LONGINT_FORMAT "\n",
+      PRICER_NAME, pricerdata->nsubsetrowcalls, pricerdata->nsubsetrowsols, pricerdata->nsubsetrowstops);
 
    return SCIP_OKAY;
 }
@@ -366,20 +2339,107 @@ SCIP_RETCODE SCIPincludePricerSRR(
    SCIP*                 scip                /**< SCIP data structure */
    )
 {
+   SCIP_PRICERDATA* pricerdata;
    SCIP_PRICER* pricer;
 
+   /* create pricer data */
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, &pricerdata) );
+
    /* include variable pricer */
    SCIP_CALL( SCIPincludePricerBasic(scip, &pricer, PRICER_NAME, PRICER_DESC, PRICER_PRIORITY, PRICER_DELAY,
-         pricerRedcostSRR, pricerFarkasSRR, NULL) );
+         pricerRedcostSRR, pricerFarkasSRR, pricerdata) );
 
    SCIP_CALL( SCIPsetPricerFree(scip, pricer, pricerFreeSRR) );
    SCIP_CALL( SCIPsetPricerInit(scip, pricer, pricerInitSRR) );
    SCIP_CALL( SCIPsetPricerExit(scip, pricer, pricerExitSRR) );
+   SCIP_CALL( SCIPsetPricerInitsol(scip, pricer, pricerInitsolSRR) );
+   SCIP_CALL( SCIPsetPricerExitsol(scip, pricer, pricerExitsolSRR) );
 
    /* include variable deleted event handler into SCIP */
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, NULL, EVENTHDLR_NAME, EVENTHDLR_DESC,
       eventExecVardeleted, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/nthreads",
+         "number of threads used for solving the matching problems of the rounds",
+         &pricerdata->nthreads, FALSE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/maxcolsround",
+         "maximal number of columns per round and pricing call, taken from the best perfect matchings (k-best)",
+         &pricerdata->maxcolsround, FALSE, DEFAULT_MAXCOLSROUND, 1, 1000, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddCharParam(scip, "pricers/" PRICER_NAME "/engine",
+         "matching engine: 'l'emon, 'd'ense blossom kernel with fixed-size instantiations, 'a'uto: DP over subsets of teams for up to 8 teams, dense kernel otherwise",
+         &pricerdata->engine, FALSE, DEFAULT_ENGINE, "lda", NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "pricers/" PRICER_NAME "/heuristic",
+         "should greedy and 2-opt matchings be tried first, solving the rounds exactly only if they find no column?",
+         &pricerdata->heuristic, FALSE, DEFAULT_HEURISTIC, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddCharParam(scip, "pricers/" PRICER_NAME "/stabilization",
+         "dual stabilization: 'n'one, 'w'entges smoothing with fixed alpha, 'i'n-out with automatically adapted alpha",
+         &pricerdata->stabilization, FALSE, DEFAULT_STABILIZATION, "nwi", NULL, NULL) );
+
+   SCIP_CALL( SCIPaddRealParam(scip, "pricers/" PRICER_NAME "/alpha",
+         "weight of the stability center in the separation point (initial weight for in-out stabilization)",
+         &pricerdata->alpha, FALSE, DEFAULT_ALPHA, 0.0, 0.99, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "pricers/" PRICER_NAME "/earlybranching",
+         "should pricing stop at a node once the rounded Lagrangian bound reaches the rounded LP value?",
+         &pricerdata->earlybranching, FALSE, DEFAULT_EARLYBRANCHING, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/tailoffiters",
+         "number of consecutive pricing calls with small LP progress after which to branch (0: off)",
+         &pricerdata->tailoffiters, FALSE, DEFAULT_TAILOFFITERS, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddRealParam(scip, "pricers/" PRICER_NAME "/tailoffgap",
+         "relative LP progress per pricing call below which the call counts as tailing off",
+         &pricerdata->tailoffgap, FALSE, DEFAULT_TAILOFFGAP, 0.0, 1.0, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/lagrangianiters",
+         "number of subgradient iterations on the Lagrangian relaxation of the match rows at the first root call (0: off)",
+         &pricerdata->lagrangianiters, FALSE, DEFAULT_LAGRANGIANITERS, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddCharParam(scip, "pricers/" PRICER_NAME "/phaseone",
+         "how to make node LPs feasible: 'f'arkas pricing, or 'b'ig-M artificial columns with automatically raised penalty",
+         &pricerdata->phaseone, FALSE, DEFAULT_PHASEONE, "fb", NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/initfactorizations",
+         "number of 1-factorizations (circle method and relabelings) whose factors are added as initial columns",
+         &pricerdata->initfactorizations, FALSE, DEFAULT_INITFACTORIZATIONS, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "pricers/" PRICER_NAME "/initsolutions",
+         "should the schedules of the initial 1-factorizations be tried as solutions, or only give columns?",
+         &pricerdata->initsolutions, FALSE, DEFAULT_INITSOLUTIONS, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/sparsetopk",
+         "number of heaviest edges per team that the rounds are first solved on, before the complete graph (0: off)",
+         &pricerdata->sparsetopk, FALSE, DEFAULT_SPARSETOPK, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/partialcols",
+         "number of columns after which an exact pass stops, solving the rounds by their last reduced value (0: all rounds)",
+         &pricerdata->partialcols, FALSE, DEFAULT_PARTIALCOLS, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "pricers/" PRICER_NAME "/skiprounds",
+         "should rounds be skipped if their last optimum and the weight changes since show that they cannot price out?",
+         &pricerdata->skiprounds, FALSE, DEFAULT_SKIPROUNDS, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/poolsize",
+         "maximal number of matchings of deleted columns kept for re-pricing (0: no column pool)",
+         &pricerdata->poolsize, FALSE, DEFAULT_POOLSIZE, 0, MAX_POOLSIZE, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "pricers/" PRICER_NAME "/redcostfixing",
+         "should edges be removed from rounds for good if the root multipliers show that no improving schedule uses them?",
+         &pricerdata->redcostfixing, FALSE, DEFAULT_REDCOSTFIXING, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "pricers/" PRICER_NAME "/subsetrowmaxsols",
+         "maximal number of matchings enumerated per round and call if subset-row cuts have non-zero duals",
+         &pricerdata->subsetrowmaxsols, FALSE, DEFAULT_SUBSETROWMAXSOLS, SUBSETROW_FIRSTSOLS, INT_MAX, NULL, NULL) );
+
+   /* include statistics table */
+   SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME, TABLE_DESC, TRUE,
+         NULL, NULL, NULL, NULL, NULL, NULL, tableOutputSRR,
+         NULL, TABLE_POSITION, TABLE_EARLIEST_STAGE) );
+
    return SCIP_OKAY;
 }
 
@@ -401,4 +2461,46 @@ SCIP_RETCODE SCIPpricerSRRActivate(
    return SCIP_OKAY;
 }
 
+/** returns the value of the root master LP once column generation proved it optimal, or -infinity if it did not
+ *
+ * Unlike the root dual bound, this value is not raised by the (rounded) Lagrangian bounds, so it is the LP relaxation
+ * value of the matching formulation.
+ */
+SCIP_Real SCIPpricerSRRGetRootLPValue(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_PRICER* pricer;
+   SCIP_PRICERDATA* pricerdata;
+
+   assert(scip != NULL);
+
+   pricer = SCIPfindPricer(scip, PRICER_NAME);
+   assert(pricer != NULL);
+
+   pricerdata = SCIPpricerGetData(pricer);
+   assert(pricerdata != NULL);
+
+   return pricerdata->rootlpobj;
+}
+
+/** returns the thread pool of the pricer, or NULL if the matching problems are solved by the calling thread only */
+SRR_THREADPOOL* SCIPpricerSRRGetThreadpool(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_PRICER* pricer;
+   SCIP_PRICERDATA* pricerdata;
+
+   assert(scip != NULL);
+
+   pricer = SCIPfindPricer(scip, PRICER_NAME);
+   assert(pricer != NULL);
+
+   pricerdata = SCIPpricerGetData(pricer);
+   assert(pricerdata != NULL);
+
+   return pricerdata->threadpool;
+}
+
 /**@} */
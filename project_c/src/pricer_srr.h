@@ -24,6 +24,11 @@
 #define __BIN_PRICER_RINGPACKING__
 
 #include "scip/scip.h"
+#include "lemon_wrapper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 
 /** creates the SRR variable pricer and includes it in SCIP */
@@ -36,4 +41,18 @@ SCIP_RETCODE SCIPpricerSRRActivate(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** returns the value of the root master LP once column generation proved it optimal, or -infinity if it did not */
+SCIP_Real SCIPpricerSRRGetRootLPValue(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+/** returns the thread pool of the pricer, or NULL if the matching problems are solved by the calling thread only */
+SRR_THREADPOOL* SCIPpricerSRRGetThreadpool(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
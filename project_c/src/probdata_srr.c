@@ -254,6 +254,7 @@ SCIP_RETCODE SCIPcreateProbSRR(
    int nelem;
    SCIP_Real coeffrac;
    SCIP_Real coefint;
+   SCIP_Bool coveringrows;
    SCIP_PROBDATA* probdata;
    SCIP_CONS** conssmatchingonround;
    SCIP_CONS** conssmatchisplayed;
@@ -291,7 +292,7 @@ SCIP_RETCODE SCIPcreateProbSRR(
    if ( k == nelem )
    {
       /* loop is not broken, integral is objective */
-      SCIPinfoMessage(scip, NULL, "Objective is integral\n");
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "Objective is integral\n");
       SCIP_CALL( SCIPsetObjIntegral(scip) );
    }
 
@@ -309,13 +310,21 @@ SCIP_RETCODE SCIPcreateProbSRR(
    }
    probdata->conssmatchingonround = conssmatchingonround;
 
-   /* linear constraint: every match is played */
+   /* linear constraint: every match is played
+    *
+    * The rows may be relaxed to covering rows: every column covers nteams / 2 matches and the round-constraints select
+    * nrounds columns, so the rows cover nmatches = nrounds * nteams / 2 matches in total, and each is covered exactly
+    * once anyway. The LP and integer solutions are the same, but the duals of the match rows are non-negative, which
+    * removes the direction of dual degeneracy along which all match duals shift against the round duals.
+    */
+   SCIP_CALL( SCIPgetBoolParam(scip, "srr/coveringrows", &coveringrows) );
    SCIPallocBlockMemoryArray(scip, &conssmatchisplayed, nmatches);
    for (k = 0; k < nmatches; ++k)
    {
       char ctrname[128];
       snprintf(ctrname, sizeof(ctrname), "match[%d]", k);
-      SCIP_CALL( SCIPcreateConsLinear(scip, &(conssmatchisplayed[k]), ctrname, 0, NULL, NULL, 1.0, 1.0, TRUE, TRUE,
+      SCIP_CALL( SCIPcreateConsLinear(scip, &(conssmatchisplayed[k]), ctrname, 0, NULL, NULL, 1.0,
+         coveringrows ? SCIPinfinity(scip) : 1.0, TRUE, TRUE,
          TRUE, TRUE, TRUE, FALSE, TRUE /*modifiable*/, FALSE, FALSE, FALSE) );
       SCIPaddCons(scip, conssmatchisplayed[k]);
    }
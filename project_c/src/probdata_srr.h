@@ -26,6 +26,10 @@
 #include "scip/type_cons.h"
 #include "scip/def.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 
 /** Get the index of the match.
  * The matches are ordered as follows
@@ -73,3 +77,7 @@ SCIP_RETCODE SCIPcreateProbSRR(
    int                   nrounds,            /**< number of rounds, must be nteams - 1 */
    SCIP_Real*            coefs               /**< objective coefficients */
 );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,285 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   prop_srrbounds.c
+ * @brief  combinatorial lower bounds for SRR at the root node
+ * @author Jasper van Doornmalen
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "prop_srrbounds.h"
+#include "probdata_srr.h"
+#include "cons_matchonround.h"
+#include "lemon_wrapper.h"
+#include "pricer_srr.h"
+
+#define PROP_NAME              "srrbounds"
+#define PROP_DESC              "combinatorial lower bounds for SRR at the root node"
+#define PROP_PRIORITY          1000000       /**< propagator priority */
+#define PROP_FREQ              0             /**< propagator frequency: only at the root node */
+#define PROP_DELAY             FALSE         /**< should propagation method be delayed, if other propagators found reductions? */
+#define PROP_TIMING            SCIP_PROPTIMING_BEFORELP /**< propagation timing mask */
+
+/*
+ * Data structures
+ */
+
+/** propagator data */
+struct SCIP_PropData
+{
+   SCIP_Bool             done;               /**< were the bounds computed in this solve? */
+   SCIP_Real             matchbound;         /**< sum over the matches of their cheapest round */
+   SCIP_Real             roundbound;         /**< sum over the rounds of their cheapest perfect matching */
+   SCIP_Real             lagrangianbound;    /**< Lagrangian bound for the cheapest round of each match as multiplier */
+};
+
+/*
+ * Local methods
+ */
+
+/** computes the three bounds; the matching problems of both Lagrangian bounds are solved together, in parallel */
+static
+SCIP_RETCODE computeBounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+)
+{
+   SRR_MATCHING** matchings;
+   const SRR_BITWORD* allowededges;
+   SRR_BITWORD* edgeexists;
+   SCIP_CONS** conssmatchingonround;
+   SCIP_CONS** conssmatchisplayed;
+   SCIP_Real* coefs;
+   SCIP_Real* mu;
+   SCIP_Real* weights;
+   SCIP_Real* minvalues;
+   SCIP_Real* solutionvalues;
+   SCIP_Real mincost;
+   int* nsols;
+   int* solutions;
+   int nteams;
+   int nrounds;
+   int nedges;
+   int nwords;
+   int i;
+   int j;
+   int k;
+   int r;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+
+   SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &nrounds, &coefs, &conssmatchingonround,
+      &conssmatchisplayed) );
+   assert( nteams % 2 == 0 );
+   assert( nrounds == nteams - 1 );
+   assert( coefs != NULL );
+
+   nedges = (nteams / 2) * (nteams - 1);
+   nwords = SRRbitsetNWords(nedges);
+
+   /* problems 0 to nrounds - 1 give the round bound, problems nrounds to 2 * nrounds - 1 the Lagrangian bound */
+   SCIP_CALL( SCIPallocBufferArray(scip, &matchings, 2 * nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgeexists, 2 * nrounds * nwords) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &mu, nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &weights, 2 * nrounds * nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &minvalues, 2 * nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nsols, 2 * nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solutionvalues, 2 * nrounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solutions, 2 * nrounds * nteams) );
+
+   /* the match bound; the cheapest round of each match is also its Lagrangian multiplier */
+   propdata->matchbound = 0.0;
+   for (i = 0; i < nteams; ++i)
+   {
+      for (j = i + 1; j < nteams; ++j)
+      {
+         k = SCIPmatchGetIndex(nteams, i, j);
+         mincost = coefs[j + i * nteams];
+         for (r = 1; r < nrounds; ++r)
+            mincost = MIN(mincost, coefs[j + i * nteams + r * nteams * nteams]);
+         mu[k] = mincost;
+         propdata->matchbound += mincost;
+      }
+   }
+
+   for (r = 0; r < nrounds; ++r)
+   {
+      SCIP_CALL( SCIPgetRoundEdgesSRRmor(scip, r, &allowededges, NULL) );
+      BMScopyMemoryArray(&edgeexists[r * nwords], allowededges, nwords);
+      BMScopyMemoryArray(&edgeexists[(nrounds + r) * nwords], allowededges, nwords);
+
+      for (i = 0; i < nteams; ++i)
+      {
+         for (j = i + 1; j < nteams; ++j)
+         {
+            k = SCIPmatchGetIndex(nteams, i, j);
+            weights[r * nedges + k] = -coefs[j + i * nteams + r * nteams * nteams];
+            weights[(nrounds + r) * nedges + k] = mu[k] - coefs[j + i * nteams + r * nteams * nteams];
+         }
+      }
+   }
+
+   for (r = 0; r < 2 * nrounds; ++r)
+   {
+      SCIP_CALL( SCIPmatchingCreateSRR(&matchings[r], nteams) );
+      minvalues[r] = -SCIPinfinity(scip);
+   }
+
+   /* the pricer creates its threads in its initsol callback, so they are available during the root propagation */
+   SCIPmatchingSolveRoundsSRR(SCIPpricerSRRGetThreadpool(scip), matchings, 2 * nrounds, 1, weights, edgeexists,
+      minvalues, NULL, nsols, solutionvalues, solutions);
+
+   propdata->roundbound = 0.0;
+   propdata->lagrangianbound = 0.0;
+   for (k = 0; k < nedges; ++k)
+      propdata->lagrangianbound += mu[k];
+   for (r = 0; r < nrounds; ++r)
+   {
+      /* without a perfect matching on some round, there is no schedule at all */
+      if ( nsols[r] == 0 || nsols[nrounds + r] == 0 )
+      {
+         propdata->roundbound = SCIPinfinity(scip);
+         propdata->lagrangianbound = SCIPinfinity(scip);
+         break;
+      }
+      propdata->roundbound -= solutionvalues[r];
+      propdata->lagrangianbound -= solutionvalues[nrounds + r];
+   }
+
+   for (r = 2 * nrounds - 1; r >= 0; --r)
+      SCIPmatchingFreeSRR(&matchings[r]);
+
+   SCIPfreeBufferArray(scip, &solutions);
+   SCIPfreeBufferArray(scip, &solutionvalues);
+   SCIPfreeBufferArray(scip, &nsols);
+   SCIPfreeBufferArray(scip, &minvalues);
+   SCIPfreeBufferArray(scip, &weights);
+   SCIPfreeBufferArray(scip, &mu);
+   SCIPfreeBufferArray(scip, &edgeexists);
+   SCIPfreeBufferArray(scip, &matchings);
+
+   return SCIP_OKAY;
+}
+
+/*
+ * Callback methods of propagator
+ */
+
+/** destructor of propagator to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_PROPFREE(propFreeSRRbounds)
+{
+   SCIP_PROPDATA* propdata;
+
+   propdata = SCIPpropGetData(prop);
+   assert( propdata != NULL );
+
+   SCIPfreeBlockMemory(scip, &propdata);
+   SCIPpropSetData(prop, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** solving process initialization method of propagator (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_PROPINITSOL(propInitsolSRRbounds)
+{
+   SCIP_PROPDATA* propdata;
+
+   propdata = SCIPpropGetData(prop);
+   assert( propdata != NULL );
+
+   propdata->done = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** execution method of propagator
+ *
+ * The bounds are computed once, at the root node before its first LP. The best one becomes the root lower bound, and
+ * if it already reaches the incumbent, the root is cut off and the incumbent is optimal.
+ */
+static
+SCIP_DECL_PROPEXEC(propExecSRRbounds)
+{
+   SCIP_PROPDATA* propdata;
+   SCIP_Real bound;
+
+   propdata = SCIPpropGetData(prop);
+   assert( propdata != NULL );
+   assert( result != NULL );
+
+   *result = SCIP_DIDNOTRUN;
+
+   if ( propdata->done || SCIPgetDepth(scip) > 0 )
+      return SCIP_OKAY;
+   propdata->done = TRUE;
+
+   SCIP_CALL( computeBounds(scip, propdata) );
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL,
+      "root bounds: match bound %g, round bound %g, Lagrangian bound %g\n",
+      propdata->matchbound, propdata->roundbound, propdata->lagrangianbound);
+
+   bound = MAX(propdata->matchbound, propdata->roundbound);
+   bound = MAX(bound, propdata->lagrangianbound);
+   if ( SCIPisInfinity(scip, bound) )
+   {
+      *result = SCIP_CUTOFF;
+      return SCIP_OKAY;
+   }
+
+   bound = SCIPtransformObj(scip, bound);
+   if ( SCIPisObjIntegral(scip) )
+      bound = SCIPfeasCeil(scip, bound);
+   SCIP_CALL( SCIPupdateLocalLowerbound(scip, bound) );
+
+   *result = SCIPisGE(scip, bound, SCIPgetCutoffbound(scip)) ? SCIP_CUTOFF : SCIP_DIDNOTFIND;
+
+   return SCIP_OKAY;
+}
+
+/*
+ * propagator specific interface methods
+ */
+
+/** creates the combinatorial root bound propagator and includes it in SCIP */
+SCIP_RETCODE SCIPincludePropSRRbounds(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_PROPDATA* propdata;
+   SCIP_PROP* prop;
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, &propdata) );
+   propdata->done = FALSE;
+   propdata->matchbound = 0.0;
+   propdata->roundbound = 0.0;
+   propdata->lagrangianbound = 0.0;
+
+   SCIP_CALL( SCIPincludePropBasic(scip, &prop, PROP_NAME, PROP_DESC, PROP_PRIORITY, PROP_FREQ, PROP_DELAY,
+         PROP_TIMING, propExecSRRbounds, propdata) );
+   assert( prop != NULL );
+
+   SCIP_CALL( SCIPsetPropFree(scip, prop, propFreeSRRbounds) );
+   SCIP_CALL( SCIPsetPropInitsol(scip, prop, propInitsolSRRbounds) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,48 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   prop_srrbounds.h
+ * @brief  combinatorial lower bounds for SRR at the root node
+ * @author Jasper van Doornmalen
+ *
+ * Before the first LP is solved, the root lower bound is taken as the best of three bounds that only need the cost
+ * coefficients:
+ * - the match bound, the sum over all matches of their cheapest round;
+ * - the round bound, the sum over all rounds of a cheapest perfect matching on that round, which is the Lagrangian
+ *   bound for zero multipliers of the match-constraints;
+ * - the Lagrangian bound for multipliers equal to the cheapest round of each match, which is at least the match bound.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SRR_PROP_SRRBOUNDS_H__
+#define __SRR_PROP_SRRBOUNDS_H__
+
+#include "scip/scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the combinatorial root bound propagator and includes it in SCIP */
+SCIP_RETCODE SCIPincludePropSRRbounds(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
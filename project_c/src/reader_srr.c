@@ -221,7 +221,7 @@ SCIP_RETCODE readSRR(
    }
 #endif
 
-   SCIPinfoMessage(scip, NULL, "Original problem: \n");
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "Original problem: \n");
 
    /* create problem data */
    SCIP_CALL( SCIPcreateProbSRR(scip, filename, nteams, nrounds, coefs) );
@@ -287,5 +287,9 @@ SCIP_RETCODE SCIPincludeReaderSRR(
    SCIP_CALL( SCIPaddCharParam(scip, "srr/model",
       "the model variant", NULL, FALSE, 'y', "xyz", NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "srr/coveringrows",
+      "should the match-constraints be covering (>= 1) rows? Equivalent to partitioning, with non-negative match duals",
+      NULL, FALSE, FALSE, NULL, NULL) );
+
    return SCIP_OKAY;
 }
@@ -0,0 +1,418 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   sepa_subsetrow.c
+ * @brief  subset-row cuts over triples of match-constraints
+ * @author Jasper van Doornmalen
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+#include <string.h>
+
+#include "scip/scip.h"
+#include "sepa_subsetrow.h"
+#include "probdata_srr.h"
+#include "vardata_srr.h"
+
+#define SEPA_NAME              "subsetrow"
+#define SEPA_DESC              "subset-row cuts over triples of match-constraints"
+#define SEPA_PRIORITY          1000
+#define SEPA_FREQ              0             /**< only at the root node */
+#define SEPA_MAXBOUNDDIST      0.0
+#define SEPA_USESSUBSCIP       FALSE
+#define SEPA_DELAY             FALSE
+
+#define DEFAULT_MAXCUTSROUND   20            /**< maximal number of cuts per separation round */
+#define DEFAULT_MAXCUTS        200           /**< maximal number of cuts in total */
+#define DEFAULT_MINVIOLATION   0.1           /**< minimal violation of a cut */
+
+/*
+ * Data structures
+ */
+
+/** separator data */
+struct SCIP_SepaData
+{
+   SCIP_ROW**            rows;               /**< rows of the cuts, of size maxcuts during the solve */
+   int*                  cutedges;           /**< the three matches of each cut */
+   int                   ncuts;              /**< number of cuts */
+   int                   maxcuts;            /**< maximal number of cuts in total */
+   int                   maxcutsround;       /**< maximal number of cuts per separation round */
+   SCIP_Real             minviolation;       /**< minimal violation of a cut */
+};
+
+/*
+ * Local methods
+ */
+
+/** inserts a candidate cut into the candidates, which keep the maxcands most violated ones */
+static
+void insertCandidate(
+   SCIP_Real*            candviolations,     /**< violations of the candidates */
+   int*                  candedges,          /**< matches of the candidates, three each */
+   int*                  ncands,             /**< pointer to the number of candidates */
+   int                   maxcands,           /**< maximal number of candidates */
+   SCIP_Real             violation,          /**< violation of the new cut */
+   int                   a,                  /**< first match of the new cut */
+   int                   b,                  /**< second match of the new cut */
+   int                   g                   /**< third match of the new cut */
+)
+{
+   int pos;
+   int c;
+
+   if ( *ncands < maxcands )
+      pos = (*ncands)++;
+   else
+   {
+      /* replace the least violated candidate, if the new cut is more violated */
+      pos = 0;
+      for (c = 1; c < maxcands; ++c)
+      {
+         if ( candviolations[c] < candviolations[pos] )
+            pos = c;
+      }
+      if ( candviolations[pos] >= violation )
+         return;
+   }
+
+   candviolations[pos] = violation;
+   candedges[3 * pos] = a;
+   candedges[3 * pos + 1] = b;
+   candedges[3 * pos + 2] = g;
+}
+
+/** adds the cut on the matches cutedges to the LP, with the columns of all matching variables */
+static
+SCIP_RETCODE addSubsetRowCut(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SEPA*            sepa,               /**< separator */
+   SCIP_SEPADATA*        sepadata,           /**< separator data */
+   const int*            cutedges            /**< the three matches of the cut */
+)
+{
+   char name[SCIP_MAXSTRLEN];
+   SCIP_VARDATA* vardata;
+   SCIP_VAR** vars;
+   SCIP_ROW* row;
+   SCIP_Bool infeasible;
+   int nvars;
+   int v;
+
+   assert( sepadata->ncuts < sepadata->maxcuts );
+
+   /* the pricer adds the columns of new matchings, so the row is modifiable */
+   (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "subsetrow_%d_%d_%d", cutedges[0], cutedges[1], cutedges[2]);
+   SCIP_CALL( SCIPcreateEmptyRowSepa(scip, &row, sepa, name, -SCIPinfinity(scip), 1.0, FALSE, TRUE, FALSE) );
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+   SCIP_CALL( SCIPcacheRowExtensions(scip, row) );
+   for (v = 0; v < nvars; ++v)
+   {
+      vardata = SCIPvarGetData(vars[v]);
+      if ( vardata != NULL && SCIPisInSubsetRowSRR(cutedges, SCIPvardataGetEdgesSRR(vardata)) )
+      {
+         SCIP_CALL( SCIPaddVarToRow(scip, row, vars[v], 1.0) );
+      }
+   }
+   SCIP_CALL( SCIPflushRowExtensions(scip, row) );
+
+   SCIP_CALL( SCIPaddRow(scip, row, FALSE, &infeasible) );
+   assert( !infeasible );
+
+   sepadata->rows[sepadata->ncuts] = row;
+   BMScopyMemoryArray(&sepadata->cutedges[3 * sepadata->ncuts], cutedges, 3);
+   ++sepadata->ncuts;
+
+   return SCIP_OKAY;
+}
+
+/*
+ * Callback methods of separator
+ */
+
+/** destructor of separator to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_SEPAFREE(sepaFreeSubsetrow)
+{  /*lint --e{715}*/
+   SCIP_SEPADATA* sepadata;
+
+   sepadata = SCIPsepaGetData(sepa);
+   assert( sepadata != NULL );
+
+   SCIPfreeBlockMemory(scip, &sepadata);
+   SCIPsepaSetData(sepa, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** solving process initialization method of separator (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_SEPAINITSOL(sepaInitsolSubsetrow)
+{  /*lint --e{715}*/
+   SCIP_SEPADATA* sepadata;
+
+   sepadata = SCIPsepaGetData(sepa);
+   assert( sepadata != NULL );
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &sepadata->rows, sepadata->maxcuts) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &sepadata->cutedges, 3 * sepadata->maxcuts) );
+   sepadata->ncuts = 0;
+
+   return SCIP_OKAY;
+}
+
+/** solving process deinitialization method of separator (called before branch and bound process data is freed) */
+static
+SCIP_DECL_SEPAEXITSOL(sepaExitsolSubsetrow)
+{  /*lint --e{715}*/
+   SCIP_SEPADATA* sepadata;
+   int c;
+
+   sepadata = SCIPsepaGetData(sepa);
+   assert( sepadata != NULL );
+
+   for (c = 0; c < sepadata->ncuts; ++c)
+   {
+      SCIP_CALL( SCIPreleaseRow(scip, &sepadata->rows[c]) );
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &sepadata->cutedges, 3 * sepadata->maxcuts);
+   SCIPfreeBlockMemoryArrayNull(scip, &sepadata->rows, sepadata->maxcuts);
+   sepadata->ncuts = 0;
+
+   return SCIP_OKAY;
+}
+
+/** LP solution separation method of separator
+ *
+ * The left-hand side of the cut on the matches U = {a, b, g} is p_ab + p_ag + p_bg - 2 p_abg, where p_ab is the LP
+ * value of the columns playing both a and b, and p_abg that of the columns playing all three. The pair values are
+ * summed up once over the columns with positive LP value; their sum bounds the left-hand side from above, so only
+ * triples passing that test are evaluated exactly.
+ */
+static
+SCIP_DECL_SEPAEXECLP(sepaExeclpSubsetrow)
+{  /*lint --e{715}*/
+   SCIP_SEPADATA* sepadata;
+   SCIP_VARDATA* vardata;
+   SCIP_VAR** vars;
+   SCIP_CONS** conssmatchingonround;
+   SCIP_CONS** conssmatchisplayed;
+   const SRR_BITWORD** coledges;
+   SCIP_Real* coefs;
+   SCIP_Real* colvalues;
+   SCIP_Real* pairs;
+   SCIP_Real* candviolations;
+   SCIP_Real lhs;
+   SCIP_Real val;
+   int* candedges;
+   int* matches;
+   int ncands;
+   int ncols;
+   int nvars;
+   int nteams;
+   int nrounds;
+   int nedges;
+   int nmatches;
+   int maxcands;
+   int a;
+   int b;
+   int c;
+   int g;
+   int k;
+   int v;
+
+   sepadata = SCIPsepaGetData(sepa);
+   assert( sepadata != NULL );
+   assert( result != NULL );
+
+   *result = SCIP_DIDNOTRUN;
+
+   maxcands = MIN(sepadata->maxcutsround, sepadata->maxcuts - sepadata->ncuts);
+   if ( maxcands <= 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetProblemDataSRR(scip, &nteams, &nrounds, &coefs, &conssmatchingonround,
+      &conssmatchisplayed) );
+   nmatches = nteams / 2;
+   nedges = nmatches * (nteams - 1);
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &coledges, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &colvalues, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &matches, nmatches) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &pairs, nedges * nedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candviolations, maxcands) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candedges, 3 * maxcands) );
+
+   *result = SCIP_DIDNOTFIND;
+
+   /* the pair values p_ab, for a < b at a * nedges + b, over the columns with positive LP value */
+   ncols = 0;
+   for (v = 0; v < nvars; ++v)
+   {
+      vardata = SCIPvarGetData(vars[v]);
+      if ( vardata == NULL )
+         continue;
+      val = SCIPgetSolVal(scip, NULL, vars[v]);
+      if ( !SCIPisFeasPositive(scip, val) )
+         continue;
+
+      coledges[ncols] = SCIPvardataGetEdgesSRR(vardata);
+      colvalues[ncols] = val;
+      ++ncols;
+
+      c = 0;
+      for (k = 0; k < nedges; ++k)
+      {
+         if ( SRRbitsetIsSet(SCIPvardataGetEdgesSRR(vardata), k) )
+            matches[c++] = k;
+      }
+      assert( c == nmatches );
+      for (a = 0; a < nmatches; ++a)
+      {
+         for (b = a + 1; b < nmatches; ++b)
+            pairs[matches[a] * nedges + matches[b]] += val;
+      }
+   }
+
+   ncands = 0;
+   for (a = 0; a < nedges; ++a)
+   {
+      for (b = a + 1; b < nedges; ++b)
+      {
+         for (g = b + 1; g < nedges; ++g)
+         {
+            if ( pairs[a * nedges + b] + pairs[a * nedges + g] + pairs[b * nedges + g] <= 1.0 + sepadata->minviolation )
+               continue;
+
+            lhs = pairs[a * nedges + b] + pairs[a * nedges + g] + pairs[b * nedges + g];
+            for (c = 0; c < ncols; ++c)
+            {
+               if ( SRRbitsetIsSet(coledges[c], a) && SRRbitsetIsSet(coledges[c], b) && SRRbitsetIsSet(coledges[c], g) )
+                  lhs -= 2.0 * colvalues[c];
+            }
+
+            if ( lhs > 1.0 + sepadata->minviolation )
+               insertCandidate(candviolations, candedges, &ncands, maxcands, lhs - 1.0, a, b, g);
+         }
+      }
+   }
+
+   for (c = 0; c < ncands; ++c)
+   {
+      SCIP_CALL( addSubsetRowCut(scip, sepa, sepadata, &candedges[3 * c]) );
+      *result = SCIP_SEPARATED;
+   }
+
+   SCIPfreeBufferArray(scip, &candedges);
+   SCIPfreeBufferArray(scip, &candviolations);
+   SCIPfreeBufferArray(scip, &pairs);
+   SCIPfreeBufferArray(scip, &matches);
+   SCIPfreeBufferArray(scip, &colvalues);
+   SCIPfreeBufferArray(scip, &coledges);
+
+   return SCIP_OKAY;
+}
+
+/*
+ * separator specific interface methods
+ */
+
+/** creates the subset-row separator and includes it in SCIP */
+SCIP_RETCODE SCIPincludeSepaSubsetrowSRR(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_SEPADATA* sepadata;
+   SCIP_SEPA* sepa;
+
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, &sepadata) );
+
+   SCIP_CALL( SCIPincludeSepaBasic(scip, &sepa, SEPA_NAME, SEPA_DESC, SEPA_PRIORITY, SEPA_FREQ, SEPA_MAXBOUNDDIST,
+         SEPA_USESSUBSCIP, SEPA_DELAY, sepaExeclpSubsetrow, NULL, sepadata) );
+   assert( sepa != NULL );
+
+   SCIP_CALL( SCIPsetSepaFree(scip, sepa, sepaFreeSubsetrow) );
+   SCIP_CALL( SCIPsetSepaInitsol(scip, sepa, sepaInitsolSubsetrow) );
+   SCIP_CALL( SCIPsetSepaExitsol(scip, sepa, sepaExitsolSubsetrow) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "separating/" SEPA_NAME "/maxcutsround",
+         "maximal number of subset-row cuts per separation round",
+         &sepadata->maxcutsround, FALSE, DEFAULT_MAXCUTSROUND, 1, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "separating/" SEPA_NAME "/maxcuts",
+         "maximal number of subset-row cuts in total, which all make the pricing problems harder",
+         &sepadata->maxcuts, FALSE, DEFAULT_MAXCUTS, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddRealParam(scip, "separating/" SEPA_NAME "/minviolation",
+         "minimal violation of a subset-row cut",
+         &sepadata->minviolation, FALSE, DEFAULT_MINVIOLATION, 0.0, 1.0, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
+
+/** returns whether a matching has coefficient one in a subset-row cut, i.e., contains at least two of its matches */
+SCIP_Bool SCIPisInSubsetRowSRR(
+   const int*            cutedges,           /**< the three matches of the cut, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edges               /**< edge bitset of the matching */
+   )
+{
+   int count;
+
+   assert( cutedges != NULL );
+   assert( edges != NULL );
+
+   count = (SRRbitsetIsSet(edges, cutedges[0]) ? 1 : 0) + (SRRbitsetIsSet(edges, cutedges[1]) ? 1 : 0)
+      + (SRRbitsetIsSet(edges, cutedges[2]) ? 1 : 0);
+
+   return count >= 2;
+}
+
+/** gets the subset-row cuts separated so far; cut c has row rows[c] and matches cutedges[3c], ..., cutedges[3c + 2] */
+void SCIPgetSubsetRowCutsSRR(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int*                  ncuts,              /**< pointer to store the number of cuts */
+   SCIP_ROW***           rows,               /**< pointer to store the rows of the cuts */
+   int**                 cutedges            /**< pointer to store the matches of the cuts */
+   )
+{
+   SCIP_SEPADATA* sepadata;
+   SCIP_SEPA* sepa;
+
+   assert( ncuts != NULL );
+   assert( rows != NULL );
+   assert( cutedges != NULL );
+
+   *ncuts = 0;
+   *rows = NULL;
+   *cutedges = NULL;
+
+   sepa = SCIPfindSepa(scip, SEPA_NAME);
+   if ( sepa == NULL )
+      return;
+
+   sepadata = SCIPsepaGetData(sepa);
+   assert( sepadata != NULL );
+
+   *ncuts = sepadata->ncuts;
+   *rows = sepadata->rows;
+   *cutedges = sepadata->cutedges;
+}
@@ -0,0 +1,65 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   sepa_subsetrow.h
+ * @ingroup SEPARATORS
+ * @brief  subset-row cuts over triples of match-constraints
+ * @author Jasper van Doornmalen
+ *
+ * For three matches U, a schedule uses at most one column that plays two or more of them, since every match is played
+ * once. This gives the rank-1 Chvatal-Gomory cut sum_{M : |M n U| >= 2} lambda_M <= 1 on the master, which fractional
+ * solutions of the set partitioning master often violate. The coefficient of a column is not a sum of coefficients of
+ * its matches, so the cuts change the pricing problems; see the matching pricer.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SRR_SEPA_SUBSETROW_H__
+#define __SRR_SEPA_SUBSETROW_H__
+
+#include "scip/scip.h"
+#include "bitset_srr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the subset-row separator and includes it in SCIP */
+SCIP_RETCODE SCIPincludeSepaSubsetrowSRR(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+/** returns whether a matching has coefficient one in a subset-row cut, i.e., contains at least two of its matches */
+SCIP_Bool SCIPisInSubsetRowSRR(
+   const int*            cutedges,           /**< the three matches of the cut, in the order of SCIPmatchGetIndex() */
+   const SRR_BITWORD*    edges               /**< edge bitset of the matching */
+   );
+
+/** gets the subset-row cuts separated so far; cut c has row rows[c] and matches cutedges[3c], ..., cutedges[3c + 2]
+ *
+ * If the separator is not included, there are no cuts.
+ */
+void SCIPgetSubsetRowCutsSRR(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int*                  ncuts,              /**< pointer to store the number of cuts */
+   SCIP_ROW***           rows,               /**< pointer to store the rows of the cuts */
+   int**                 cutedges            /**< pointer to store the matches of the cuts */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
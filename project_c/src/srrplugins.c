@@ -27,6 +27,8 @@
 #include "reader_srr.h"
 #include "pricer_srr.h"
 #include "cons_matchonround.h"
+#include "prop_srrbounds.h"
+#include "sepa_subsetrow.h"
 
 /** includes default plugins for SRR into SCIP */
 SCIP_RETCODE SCIPincludeSRRPlugins(
@@ -176,13 +178,27 @@ SCIP_RETCODE SCIPincludeSRRPlugins(
    /* Constraint handler for branching decisions */
    SCIP_CALL( SCIPincludeConshdlrSRR(scip) );
 
+   /* Combinatorial lower bounds at the root */
+   SCIP_CALL( SCIPincludePropSRRbounds(scip) );
+
    /* for column generation instances, disable restarts */
    SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrestarts", 0) );
 
-   /* turn off all separation algorithms */
+   /* Turn off all separation algorithms. The master is the Dantzig-Wolfe reformulation by round: the aggregated values
+    * x[i,j,r] of the LP of each round are a convex combination of perfect matchings on the round's usable edges. So
+    * every inequality on x that is valid for the perfect matchings of a single round is satisfied already, which
+    * includes the odd-set inequalities and the clique inequalities of the conflict graph of the match-round pairs
+    * (its cliques are the match-once rows, the stars of a team on a round and the triangles on a round). A robust cut
+    * that can be violated has to couple several rounds beyond the match-once rows.
+    */
    SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
    SCIP_CALL( SCIPsetIntParam(scip, "separating/maxrounds", 0) );
    SCIP_CALL( SCIPsetIntParam(scip, "separating/maxroundsroot", 0) );
 
+   /* The subset-row cuts couple the rounds through the columns. Their separator is included after the others were
+    * turned off; it runs at the root if separating/maxroundsroot is set to a positive value.
+    */
+   SCIP_CALL( SCIPincludeSepaSubsetrowSRR(scip) );
+
    return SCIP_OKAY;
 }
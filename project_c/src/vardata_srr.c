@@ -0,0 +1,215 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   vardata_srr.c
+ * @brief  variable data of the SRR matching variables
+ * @author Jasper van Doornmalen
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "probdata_srr.h"
+#include "vardata_srr.h"
+
+/** variable data of a matching variable */
+struct SCIP_VarData
+{
+   int                   round;              /**< round of the matching */
+   int                   nwords;             /**< number of words of edges */
+   SRR_BITWORD*          edges;              /**< bitset of the matches of the matching */
+};
+
+/**@name Local methods
+ *
+ * @{
+ */
+
+/** creates variable data with a copy of the given edge bitset */
+static
+SCIP_RETCODE vardataCreate(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VARDATA**        vardata,            /**< pointer to store the variable data */
+   int                   round,              /**< round of the matching */
+   int                   nwords,             /**< number of words of edges */
+   const SRR_BITWORD*    edges               /**< bitset of the matches of the matching */
+   )
+{
+   SCIP_CALL( SCIPallocBlockMemory(scip, vardata) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*vardata)->edges, edges, nwords) );
+   (*vardata)->round = round;
+   (*vardata)->nwords = nwords;
+
+   return SCIP_OKAY;
+}
+
+/** frees variable data */
+static
+SCIP_RETCODE vardataDelete(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VARDATA**        vardata             /**< pointer to the variable data */
+   )
+{
+   SCIPfreeBlockMemoryArray(scip, &(*vardata)->edges, (*vardata)->nwords);
+   SCIPfreeBlockMemory(scip, vardata);
+
+   return SCIP_OKAY;
+}
+
+/**@} */
+
+/**@name Callback methods
+ *
+ * @{
+ */
+
+/** frees user data of original variable (called when the original variable is freed) */
+static
+SCIP_DECL_VARDELORIG(vardataDelOrig)
+{
+   SCIP_CALL( vardataDelete(scip, vardata) );
+
+   return SCIP_OKAY;
+}/*lint !e715*/
+
+/** creates user data of transformed variable by transforming the original user variable data */
+static
+SCIP_DECL_VARTRANS(vardataTrans)
+{
+   SCIP_CALL( vardataCreate(scip, targetdata, sourcedata->round, sourcedata->nwords, sourcedata->edges) );
+
+   return SCIP_OKAY;
+}/*lint !e715*/
+
+/** frees user data of transformed variable (called when the transformed variable is freed) */
+static
+SCIP_DECL_VARDELTRANS(vardataDelTrans)
+{
+   SCIP_CALL( vardataDelete(scip, vardata) );
+
+   return SCIP_OKAY;
+}/*lint !e715*/
+
+/**@} */
+
+
+/**@name Interface methods
+ *
+ * @{
+ */
+
+/** creates the variable data of the matching `solution` on round r */
+SCIP_RETCODE SCIPvardataCreateSRR(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VARDATA**        vardata,            /**< pointer to store the variable data */
+   int                   nteams,             /**< number of teams */
+   int                   round,              /**< round of the matching */
+   const int*            solution            /**< opponent of each team in the matching */
+   )
+{
+   SRR_BITWORD* edges;
+   int nedges;
+   int nwords;
+   int i;
+
+   assert( scip != NULL );
+   assert( vardata != NULL );
+   assert( solution != NULL );
+
+   nedges = (nteams / 2) * (nteams - 1);
+   nwords = SRRbitsetNWords(nedges);
+
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &edges, nwords) );
+   for (i = 0; i < nteams; ++i)
+   {
+      assert( solution[solution[i]] == i );
+      if ( i < solution[i] )
+         SRRbitsetSet(edges, SCIPmatchGetIndex(nteams, i, solution[i]));
+   }
+
+   SCIP_CALL( vardataCreate(scip, vardata, round, nwords, edges) );
+
+   SCIPfreeBufferArray(scip, &edges);
+
+   return SCIP_OKAY;
+}
+
+/** returns the round of a matching variable */
+int SCIPvardataGetRoundSRR(
+   SCIP_VARDATA*         vardata             /**< variable data */
+   )
+{
+   assert( vardata != NULL );
+
+   return vardata->round;
+}
+
+/** returns the edge bitset of the matching of a matching variable */
+const SRR_BITWORD* SCIPvardataGetEdgesSRR(
+   SCIP_VARDATA*         vardata             /**< variable data */
+   )
+{
+   assert( vardata != NULL );
+
+   return vardata->edges;
+}
+
+/** returns whether the matching only uses edges of the given bitset */
+SCIP_Bool SCIPvardataIsAllowedSRR(
+   SCIP_VARDATA*         vardata,            /**< variable data */
+   const SRR_BITWORD*    allowededges        /**< bitset of the edges that may be used */
+   )
+{
+   int w;
+
+   assert( vardata != NULL );
+   assert( allowededges != NULL );
+
+   for (w = 0; w < vardata->nwords; ++w)
+   {
+      if ( (vardata->edges[w] & ~allowededges[w]) != 0 )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** creates a matching variable with the given variable data
+ *
+ * The variable is binary with objective coefficient obj. The variable data is owned by the variable, and freed with it.
+ */
+SCIP_RETCODE SCIPcreateVarSRR(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            var,                /**< pointer to store the variable */
+   const char*           name,               /**< name of the variable, or NULL */
+   SCIP_Real             obj,                /**< objective coefficient */
+   SCIP_Bool             initial,            /**< should the variable be in the initial LP? */
+   SCIP_Bool             removable,          /**< may the column be removed from the LP due to aging? */
+   SCIP_VARDATA*         vardata             /**< variable data */
+   )
+{
+   assert( scip != NULL );
+   assert( var != NULL );
+   assert( vardata != NULL );
+
+   SCIP_CALL( SCIPcreateVar(scip, var, name, 0.0, 1.0, obj, SCIP_VARTYPE_BINARY, initial, removable,
+         vardataDelOrig, vardataTrans, vardataDelTrans, NULL, vardata) );
+
+   return SCIP_OKAY;
+}
+
+/**@} */
@@ -0,0 +1,79 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   vardata_srr.h
+ * @brief  variable data of the SRR matching variables
+ * @author Jasper van Doornmalen
+ *
+ * A matching variable stands for a perfect matching of the teams that is played on one round. Its variable data is the
+ * round, and the matching as a bitset over the matches in the ordering of SCIPmatchGetIndex().
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SRR_VARDATA_H__
+#define __SRR_VARDATA_H__
+
+#include "scip/scip.h"
+#include "bitset_srr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the variable data of the matching `solution` on round r */
+SCIP_RETCODE SCIPvardataCreateSRR(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VARDATA**        vardata,            /**< pointer to store the variable data */
+   int                   nteams,             /**< number of teams */
+   int                   round,              /**< round of the matching */
+   const int*            solution            /**< opponent of each team in the matching */
+   );
+
+/** returns the round of a matching variable */
+int SCIPvardataGetRoundSRR(
+   SCIP_VARDATA*         vardata             /**< variable data */
+   );
+
+/** returns the edge bitset of the matching of a matching variable */
+const SRR_BITWORD* SCIPvardataGetEdgesSRR(
+   SCIP_VARDATA*         vardata             /**< variable data */
+   );
+
+/** returns whether the matching only uses edges of the given bitset */
+SCIP_Bool SCIPvardataIsAllowedSRR(
+   SCIP_VARDATA*         vardata,            /**< variable data */
+   const SRR_BITWORD*    allowededges        /**< bitset of the edges that may be used */
+   );
+
+/** creates a matching variable with the given variable data
+ *
+ * The variable is binary with objective coefficient obj. The variable data is owned by the variable, and freed with it.
+ */
+SCIP_RETCODE SCIPcreateVarSRR(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            var,                /**< pointer to store the variable */
+   const char*           name,               /**< name of the variable, or NULL */
+   SCIP_Real             obj,                /**< objective coefficient */
+   SCIP_Bool             initial,            /**< should the variable be in the initial LP? */
+   SCIP_Bool             removable,          /**< may the column be removed from the LP due to aging? */
+   SCIP_VARDATA*         vardata             /**< variable data */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif